@@ -24,284 +24,3039 @@
 
 #endif
 
-STATIC const Port_ConfigPin * Port_Pins = (Port_Configuration.Pins);
+#if ((PORT_CONFIG_IMAGE_SUPPORT == STD_ON) || (PORT_CONTEXT_API == STD_ON))
+/* offsetof, from the configuration back to the header of its image and to the CRC of a context */
+#include <stddef.h>
+#endif
+
+#if ((PORT_PIN_OWNERSHIP == STD_ON) && !defined(PORT_HOST_BUILD))
+/* GetApplicationID, the partition of the caller */
+#include "Os.h"
+#endif
+
+#if ((PORT_PIN_INTERRUPT_API == STD_ON) && !defined(PORT_HOST_BUILD))
+/* Exclusive area of Port_EnablePinInterrupts and Port_DisablePinInterrupts */
+#include "SchM_Port.h"
+#endif
+
+/* Register image of one port, built from the configured pins by Port_Init */
+typedef struct
+{
+	/* Configured pins of the port */
+	uint32 PinMask;
+
+	/* Configured pins with PORT_PIN_PRIORITY_CRITICAL, programmed first */
+	uint32 CriticalMask;
+
+	/* Nibbles of GPIOPCTL owned by the configured pins */
+	uint32 PctlMask;
+
+	uint32 Amsel;
+
+	uint32 Den;
+
+	uint32 Afsel;
+
+	uint32 Pctl;
+
+	uint32 Dir;
+
+	/* Output pins, the only pins whose initial level is driven */
+	uint32 OutputMask;
+
+	uint32 Data;
+
+	uint32 Pur;
+
+	uint32 Pdr;
+
+	/* Pins with a non changeable direction, restored by Port_RefreshPortDirection */
+	uint32 RefreshMask;
+
+	uint32 Is;
+
+	uint32 Ibe;
+
+	uint32 Iev;
+
+	/* Pins configured with an interrupt, armed by Port_Init */
+	uint32 Im;
+
+	uint32 Dr2r;
+
+	uint32 Dr4r;
+
+	uint32 Dr8r;
+
+	uint32 Slr;
+
+	uint32 Odr;
+
+	uint32 Adcctl;
+
+	uint32 Dmactl;
+
+}Port_PortImageType;
+
+/* Runtime descriptor of one pin, built by Port_Init so the runtime APIs need a single indexed load */
+typedef struct
+{
+	/* Base address of the GPIO block of the pin */
+	uint32 Base;
+
+	/* Nibble of GPIOPCTL owned by the pin */
+	uint32 PctlMask;
+
+	/* Bit of the pin in the port registers */
+	uint8 PinBit;
+
+	uint8 PctlShift;
+
+	/* PORT_PIN_FLAG_* */
+	uint8 Flags;
+
+	uint8 Port;
+
+}Port_PinDescriptorType;
+
+#define PORT_PIN_FLAG_DIRECTION_CHANGEABLE      (0x01U)
+#define PORT_PIN_FLAG_MODE_CHANGEABLE           (0x02U)
+#define PORT_PIN_FLAG_ANALOG                    (0x04U)
+
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+
+#if (PORT_NUMBER_OF_PIN_GROUPS == 0U)
+#error "The Set Group Direction API needs at least one pin group"
+#endif
+
+/* Runtime descriptor of one pin group, so Port_SetGroupDirection is a single read-modify-write of GPIODIR */
+typedef struct
+{
+	/* Base address of the GPIO block of the group */
+	uint32 Base;
+
+	/* Pins of the group, 0 for a group rejected by Port_Init */
+	uint32 Pins;
+
+	uint8 Port;
+
+}Port_GroupDescriptorType;
+
+#endif
+
+#if (PORT_MODE_PROFILE_API == STD_ON)
+
+#if (PORT_NUMBER_OF_MODE_PROFILES == 0U)
+#error "The Set Mode Profile API needs at least one mode profile"
+#endif
+
+/* Registers written by a mode profile switch */
+#define PORT_PROFILE_REG_AMSEL                  (0x01U)
+#define PORT_PROFILE_REG_DEN                    (0x02U)
+#define PORT_PROFILE_REG_PCTL                   (0x04U)
+#define PORT_PROFILE_REG_AFSEL                  (0x08U)
+#define PORT_PROFILE_REG_ALL                    (0x0FU)
+
+/* No mode profile applied since Port_Init, or its pins changed since */
+#define PORT_PROFILE_NONE                       (0xFFU)
+
+/* Register values of the pins of one port in one mode profile, precomputed by Port_Init */
+typedef struct
+{
+	/* Base address of the GPIO block of the port */
+	uint32 Base;
+
+	/* Pins of the port in the profile and their nibbles of GPIOPCTL */
+	uint32 Pins;
+
+	uint32 PctlMask;
+
+	uint32 Amsel;
+
+	uint32 Den;
+
+	uint32 Afsel;
+
+	uint32 Pctl;
+
+	uint8 Port;
+
+}Port_ProfilePortType;
+
+/* Ports of one mode profile in Port_ProfilePorts, no ports for a profile rejected by Port_Init */
+typedef struct
+{
+	uint16 First;
+
+	uint16 Count;
+
+}Port_ProfileDescriptorType;
+
+#endif
+
+STATIC const Port_DeviceDescriptorType Port_Device[PORT_DEVICE_NUMBER_OF_PORTS] = PORT_DEVICE_DESCRIPTORS;
+
 STATIC uint8 Port_Status = PORT_NOT_INITIALIZED;
-STATIC boolean ClockConfigured[PORT_NUMBER_OF_PORTS] = {FALSE};
+
+#if (PORT_CONFIG_VARIANT == PORT_VARIANT_PRE_COMPILE)
+
+/*
+ * Pre-compile variant: the port images and the pin descriptors are constant
+ * expressions of PORT_PRECOMPILE_PINS. Every PORT_PC_<FIELD> macro is one
+ * entry of the pin list contributing its bit to the image of port P.
+ */
+#define PORT_PC_BIT(P, PORT, PIN, COND)      | (((((uint32)(PORT)) == ((uint32)(P))) && (COND)) ? (((uint32)1) << (PIN)) : 0U)
+#define PORT_PC_NIBBLE(P, PORT, PIN, COND, VALUE) \
+		| (((((uint32)(PORT)) == ((uint32)(P))) && (COND)) ? (((uint32)(VALUE)) << (4U * (PIN))) : 0U)
+
+#define PORT_PC_IS_ALTERNATE(MODE)           (((MODE) != PORT_MODE_DIO) && ((MODE) != PORT_MODE_ADC))
+#define PORT_PC_HAS_ADC_TRIGGER(TRIG)        (((TRIG) == PORT_PIN_TRIGGER_ADC) || ((TRIG) == PORT_PIN_TRIGGER_ADC_AND_DMA))
+#define PORT_PC_HAS_DMA_TRIGGER(TRIG)        (((TRIG) == PORT_PIN_TRIGGER_DMA) || ((TRIG) == PORT_PIN_TRIGGER_ADC_AND_DMA))
+
+#define PORT_PC_PIN_MASK(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO)    PORT_PC_BIT(P, PORT, PIN, TRUE)
+#define PORT_PC_CRITICAL(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO)    PORT_PC_BIT(P, PORT, PIN, (PRIO) == PORT_PIN_PRIORITY_CRITICAL)
+#define PORT_PC_PCTL_MASK(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO)   PORT_PC_NIBBLE(P, PORT, PIN, TRUE, 0x0FU)
+#define PORT_PC_AMSEL(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO)       PORT_PC_BIT(P, PORT, PIN, (MODE) == PORT_MODE_ADC)
+#define PORT_PC_DEN(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO)         PORT_PC_BIT(P, PORT, PIN, (MODE) != PORT_MODE_ADC)
+#define PORT_PC_AFSEL(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO)       PORT_PC_BIT(P, PORT, PIN, PORT_PC_IS_ALTERNATE(MODE))
+#define PORT_PC_PCTL(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO)        PORT_PC_NIBBLE(P, PORT, PIN, PORT_PC_IS_ALTERNATE(MODE), MODE)
+#define PORT_PC_DIR(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO)         PORT_PC_BIT(P, PORT, PIN, (DIR) == PORT_PIN_OUT)
+#define PORT_PC_DATA(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO) \
+		PORT_PC_BIT(P, PORT, PIN, ((DIR) == PORT_PIN_OUT) && ((LEVEL) == PORT_PIN_LEVEL_HIGH))
+#define PORT_PC_PUR(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO) \
+		PORT_PC_BIT(P, PORT, PIN, ((DIR) != PORT_PIN_OUT) && ((RES) == PORT_RESISTANCE_PULL_UP))
+#define PORT_PC_PDR(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO) \
+		PORT_PC_BIT(P, PORT, PIN, ((DIR) != PORT_PIN_OUT) && ((RES) == PORT_RESISTANCE_PULL_DOWN))
+#define PORT_PC_REFRESH(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO) \
+		PORT_PC_BIT(P, PORT, PIN, (CHD) == PORT_PIN_DIRECTION_NON_CHANGEABLE)
+#define PORT_PC_IS(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO) \
+		PORT_PC_BIT(P, PORT, PIN, ((IRQ) == PORT_PIN_INTERRUPT_LOW_LEVEL) || ((IRQ) == PORT_PIN_INTERRUPT_HIGH_LEVEL))
+#define PORT_PC_IBE(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO) \
+		PORT_PC_BIT(P, PORT, PIN, (IRQ) == PORT_PIN_INTERRUPT_BOTH_EDGES)
+#define PORT_PC_IEV(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO) \
+		PORT_PC_BIT(P, PORT, PIN, ((IRQ) == PORT_PIN_INTERRUPT_RISING_EDGE) || ((IRQ) == PORT_PIN_INTERRUPT_HIGH_LEVEL))
+#define PORT_PC_IM(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO) \
+		PORT_PC_BIT(P, PORT, PIN, ((IRQ) > PORT_PIN_INTERRUPT_NONE) && ((IRQ) <= PORT_PIN_INTERRUPT_HIGH_LEVEL))
+#define PORT_PC_DR2R(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO) \
+		PORT_PC_BIT(P, PORT, PIN, ((DRV) != PORT_PIN_DRIVE_4MA) && ((DRV) != PORT_PIN_DRIVE_8MA))
+#define PORT_PC_DR4R(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO)        PORT_PC_BIT(P, PORT, PIN, (DRV) == PORT_PIN_DRIVE_4MA)
+#define PORT_PC_DR8R(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO)        PORT_PC_BIT(P, PORT, PIN, (DRV) == PORT_PIN_DRIVE_8MA)
+#define PORT_PC_SLR(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO) \
+		PORT_PC_BIT(P, PORT, PIN, ((DRV) == PORT_PIN_DRIVE_8MA) && ((SLEW) == PORT_PIN_SLEW_RATE_CONTROLLED))
+#define PORT_PC_ODR(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO)         PORT_PC_BIT(P, PORT, PIN, (OUT) == PORT_PIN_OUTPUT_OPEN_DRAIN)
+#define PORT_PC_ADCCTL(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO)      PORT_PC_BIT(P, PORT, PIN, PORT_PC_HAS_ADC_TRIGGER(TRIG))
+#define PORT_PC_DMACTL(P, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO)      PORT_PC_BIT(P, PORT, PIN, PORT_PC_HAS_DMA_TRIGGER(TRIG))
+
+#define PORT_PC_REG(FIELD, P)                (0U PORT_PRECOMPILE_PINS(FIELD, P))
+
+/* Register image of port P, in the order of Port_PortImageType */
+#define PORT_PC_IMAGE(P) { \
+		PORT_PC_REG(PORT_PC_PIN_MASK, P), PORT_PC_REG(PORT_PC_CRITICAL, P), PORT_PC_REG(PORT_PC_PCTL_MASK, P), \
+		PORT_PC_REG(PORT_PC_AMSEL, P), PORT_PC_REG(PORT_PC_DEN, P), \
+		PORT_PC_REG(PORT_PC_AFSEL, P), PORT_PC_REG(PORT_PC_PCTL, P), \
+		PORT_PC_REG(PORT_PC_DIR, P), PORT_PC_REG(PORT_PC_DIR, P), PORT_PC_REG(PORT_PC_DATA, P), \
+		PORT_PC_REG(PORT_PC_PUR, P), PORT_PC_REG(PORT_PC_PDR, P), PORT_PC_REG(PORT_PC_REFRESH, P), \
+		PORT_PC_REG(PORT_PC_IS, P), PORT_PC_REG(PORT_PC_IBE, P), PORT_PC_REG(PORT_PC_IEV, P), PORT_PC_REG(PORT_PC_IM, P), \
+		PORT_PC_REG(PORT_PC_DR2R, P), PORT_PC_REG(PORT_PC_DR4R, P), PORT_PC_REG(PORT_PC_DR8R, P), \
+		PORT_PC_REG(PORT_PC_SLR, P), PORT_PC_REG(PORT_PC_ODR, P), \
+		PORT_PC_REG(PORT_PC_ADCCTL, P), PORT_PC_REG(PORT_PC_DMACTL, P) }
+
+/* Entries of PORT_DEVICE_PORT_LIST: the image of port ID, and its phase applied in Port_ApplyPhase */
+#define PORT_PC_PORT_IMAGE(ARG, ID, BASE, PINS, LOCKED, RESERVED, ANALOG)   PORT_PC_IMAGE(ID),
+#define PORT_PC_APPLY_PORT(ARG, ID, BASE, PINS, LOCKED, RESERVED, ANALOG)   Port_ApplyPortPhase((ID), (ARG));
+
+/* Runtime descriptor of one pin, in the order of Port_PinDescriptorType */
+#define PORT_PC_DESCRIPTOR(ARG, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO) { \
+		PORT_DEVICE_BASE_ADDRESS(PORT), \
+		((uint32)0x0F) << (4U * (PIN)), \
+		(uint8)(((uint32)1) << (PIN)), \
+		(uint8)(4U * (PIN)), \
+		(uint8)((((CHD) == PORT_PIN_DIRECTION_CHANGEABLE) ? PORT_PIN_FLAG_DIRECTION_CHANGEABLE : 0U) \
+				| (((CHM) == PORT_PIN_MODE_CHANGEABLE) ? PORT_PIN_FLAG_MODE_CHANGEABLE : 0U) \
+				| ((0U != (PORT_DEVICE_ANALOG_PINS(PORT) & (((uint32)1) << (PIN)))) ? PORT_PIN_FLAG_ANALOG : 0U)), \
+		(uint8)(PORT) },
+
+#define PORT_PC_PORT_BIT(ARG, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO)  | (((uint32)1) << (PORT))
+#define PORT_PC_COUNT(ARG, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO)     + 1U
+
+/* Ports with at least one configured pin */
+#define PORT_PC_CONFIGURED_PORTS             (0U PORT_PRECOMPILE_PINS(PORT_PC_PORT_BIT, 0U))
+
+/* Port_ApplyPortImage is expanded in Port_Init for every port and phase, so each value folds into a constant store */
+#if defined(__GNUC__)
+#define PORT_APPLY_INLINE                    LOCAL_INLINE __attribute__((always_inline))
+#else
+#define PORT_APPLY_INLINE                    LOCAL_INLINE
+#endif
+
+/* The tables of the pre-compile variant have one entry per port of PORT_DEVICE_PORT_LIST */
+#if (PORT_NUMBER_OF_PORTS != PORT_DEVICE_NUMBER_OF_PORTS)
+#error "The pre-compile variant configures every port of the device: PORT_NUMBER_OF_PORTS must be PORT_DEVICE_NUMBER_OF_PORTS"
+#endif
+
+/* PORT_PRECOMPILE_PINS must list exactly PORT_NUMBER_OF_PORT_PINS pins */
+typedef char Port_PrecompilePinCountCheck[((0U PORT_PRECOMPILE_PINS(PORT_PC_COUNT, 0U)) == PORT_NUMBER_OF_PORT_PINS) ? 1 : -1];
+
+STATIC const Port_PortImageType Port_PortImages[PORT_NUMBER_OF_PORTS] = {
+		PORT_DEVICE_PORT_LIST(PORT_PC_PORT_IMAGE, 0U)
+};
+
+STATIC const Port_PinDescriptorType Port_PinDescriptors[PORT_NUMBER_OF_PORT_PINS] = {
+		PORT_PRECOMPILE_PINS(PORT_PC_DESCRIPTOR, 0U)
+};
+
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+
+/* Pins of port P configured with PORT_PIN_DIRECTION_CHANGEABLE */
+#define PORT_PC_DIRECTION_CHANGEABLE(P)      (PORT_PC_REG(PORT_PC_PIN_MASK, P) & ~PORT_PC_REG(PORT_PC_REFRESH, P))
+
+#define PORT_PC_GROUP_DESCRIPTOR(ARG, PORT, PINS)    { PORT_DEVICE_BASE_ADDRESS(PORT), (uint32)(PINS), (uint8)(PORT) },
+#define PORT_PC_GROUP_VALID(ARG, PORT, PINS)         && ((PINS) != 0U) && (0U == ((PINS) & ~PORT_PC_DIRECTION_CHANGEABLE(PORT)))
+#define PORT_PC_GROUP_COUNT(ARG, PORT, PINS)         + 1U
+
+/* PORT_PRECOMPILE_GROUPS must list PORT_NUMBER_OF_PIN_GROUPS groups of direction changeable pins */
+typedef char Port_PrecompileGroupCheck[(((0U PORT_PRECOMPILE_GROUPS(PORT_PC_GROUP_COUNT, 0U)) == PORT_NUMBER_OF_PIN_GROUPS)
+		PORT_PRECOMPILE_GROUPS(PORT_PC_GROUP_VALID, 0U)) ? 1 : -1];
+
+STATIC const Port_GroupDescriptorType Port_GroupDescriptors[PORT_NUMBER_OF_PIN_GROUPS] = {
+		PORT_PRECOMPILE_GROUPS(PORT_PC_GROUP_DESCRIPTOR, 0U)
+};
+
+#endif
+
+/*
+ * Checks of the profile and partition lists: ENTRY applies ARG to the ID of an entry,
+ * the pins entries must name an entry and a port, they are dropped from the tables otherwise
+ */
+#define PORT_PC_PROFILE_ENTRY(ARG, ID, MODE)         ARG(ID)
+#define PORT_PC_PARTITION_ENTRY(ARG, ID)             ARG(ID)
+#define PORT_PC_ENTRY_COUNT(ID)                      + 1U
+#define PORT_PC_ENTRY_BIT(ID)                        | (((uint32)1) << (ID))
+#define PORT_PC_ENTRY_PINS_VALID(ARG, ID, PORT, PINS) \
+		&& ((ID) < (ARG)) && ((PORT) < PORT_NUMBER_OF_PORTS) && ((PINS) != 0U)
+
+/* LIST must have the entries 0 to COUNT - 1, each once */
+#define PORT_PC_LIST_VALID(LIST, ENTRY, PINS_LIST, COUNT) \
+		(((0U LIST(ENTRY, PORT_PC_ENTRY_COUNT)) == (COUNT)) \
+		&& ((0U LIST(ENTRY, PORT_PC_ENTRY_BIT)) == ((((uint32)1) << (COUNT)) - 1U)) \
+		PINS_LIST(PORT_PC_ENTRY_PINS_VALID, (COUNT)))
+
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+
+typedef char Port_PrecompilePartitionCheck[PORT_PC_LIST_VALID(PORT_PRECOMPILE_PARTITIONS, PORT_PC_PARTITION_ENTRY,
+		PORT_PRECOMPILE_PARTITION_PINS, PORT_NUMBER_OF_PARTITIONS) ? 1 : -1];
+
+STATIC const Port_ConfigPartition Port_Partitions[PORT_NUMBER_OF_PARTITIONS] = PORT_PRECOMPILE_PARTITION_TABLE;
+#endif
+
+#else
+
+STATIC const Port_ConfigPin * Port_Pins = (Port_Configuration.Pins);
+STATIC const Port_ConfigType * Port_ConfigPtr = &Port_Configuration;
+STATIC Port_PortImageType Port_PortImages[PORT_NUMBER_OF_PORTS];
+STATIC Port_PinDescriptorType Port_PinDescriptors[PORT_NUMBER_OF_PORT_PINS];
+
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+STATIC Port_GroupDescriptorType Port_GroupDescriptors[PORT_NUMBER_OF_PIN_GROUPS];
+#endif
+
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+/* Read in place from the configuration given to Port_Init */
+STATIC const Port_ConfigPartition * Port_Partitions = Port_Configuration.Partitions;
+#endif
+
+#define PORT_APPLY_INLINE                    STATIC
+
+#endif
+
+/*
+ * Last value written to GPIOIM of every port, so arming never reads it back.
+ * GPIOIM belongs to the Port driver: every write to it goes through this shadow.
+ */
+STATIC uint32 Port_InterruptMasks[PORT_NUMBER_OF_PORTS];
+
+#if (PORT_MODE_PROFILE_API == STD_ON)
+
+#if (PORT_CONFIG_VARIANT == PORT_VARIANT_PRE_COMPILE)
+
+typedef char Port_PrecompileProfileCheck[PORT_PC_LIST_VALID(PORT_PRECOMPILE_MODE_PROFILES, PORT_PC_PROFILE_ENTRY,
+		PORT_PRECOMPILE_PROFILE_PINS, PORT_NUMBER_OF_MODE_PROFILES) ? 1 : -1];
+
+STATIC const Port_ConfigProfile Port_PrecompileProfiles[PORT_NUMBER_OF_MODE_PROFILES] = PORT_PRECOMPILE_PROFILE_TABLE;
+#endif
+
+STATIC Port_ProfilePortType Port_ProfilePorts[PORT_NUMBER_OF_MODE_PROFILES * PORT_NUMBER_OF_PORTS];
+STATIC Port_ProfileDescriptorType Port_ProfileDescriptors[PORT_NUMBER_OF_MODE_PROFILES];
+
+/* Registers a switch from profile [From] to profile [To] writes: those whose values differ */
+STATIC uint8 Port_ProfileDeltas[PORT_NUMBER_OF_MODE_PROFILES][PORT_NUMBER_OF_MODE_PROFILES];
+
+/* Last profile applied, its pins still hold its register values */
+STATIC uint8 Port_ActiveProfile = PORT_PROFILE_NONE;
+
+#endif
+
+#if (PORT_EVENT_LOG == STD_ON)
+
+#if !defined(__GNUC__)
+#error "The event log appends with the __atomic builtins of GCC and Clang"
+#endif
+
+#if ((PORT_EVENT_LOG_SIZE == 0U) || ((PORT_EVENT_LOG_SIZE & (PORT_EVENT_LOG_SIZE - 1U)) != 0U))
+#error "PORT_EVENT_LOG_SIZE must be a power of two"
+#endif
+
+/*
+ * Ring buffer of the event log, kept across Port_Init calls. A writer claims the
+ * next sequence number with one atomic increment and owns the slot of that number,
+ * so tasks and ISRs append without a lock. The Sequence field of a slot is 0 while
+ * the slot is written, else the sequence number of its record plus 1, so
+ * Port_GetEvent can tell a record overwritten under it.
+ */
+STATIC Port_EventType Port_EventLog[PORT_EVENT_LOG_SIZE];
+STATIC uint32 Port_EventHead = 0U;
+
+/*
+ * Append one record. The device has a single core, so compiler fences are
+ * enough to order the slot against a preempting ISR or reader.
+ */
+LOCAL_INLINE void Port_LogEvent(uint8 ServiceId, uint8 ErrorId, Port_PinType Pin, uint8 OldValue, uint8 NewValue)
+{
+	uint32 Sequence = __atomic_fetch_add(&Port_EventHead, 1U, __ATOMIC_RELAXED);
+	Port_EventType * Record = &Port_EventLog[Sequence & (PORT_EVENT_LOG_SIZE - 1U)];
+
+	__atomic_store_n(&Record->Sequence, 0U, __ATOMIC_RELAXED);
+	__atomic_signal_fence(__ATOMIC_RELEASE);
+
+	Record->Timestamp = PORT_EVENT_LOG_TIMESTAMP();
+	Record->ServiceId = ServiceId;
+	Record->ErrorId = ErrorId;
+	Record->Pin = Pin;
+	Record->OldValue = OldValue;
+	Record->NewValue = NewValue;
+
+	__atomic_signal_fence(__ATOMIC_RELEASE);
+	__atomic_store_n(&Record->Sequence, Sequence + 1U, __ATOMIC_RELAXED);
+}
+
+/* Mode of a pin from the values of its GPIOAMSEL, GPIOAFSEL and GPIOPCTL */
+LOCAL_INLINE uint8 Port_ModeOf(const Port_PinDescriptorType * Descriptor, uint32 Amsel, uint32 Afsel, uint32 Pctl)
+{
+	uint8 Mode = PORT_MODE_DIO;
+
+	if(0U != (Amsel & Descriptor->PinBit)){
+
+		Mode = PORT_MODE_ADC;
+	}
+
+	else if(0U != (Afsel & Descriptor->PinBit)){
+
+		Mode = (uint8)((Pctl & Descriptor->PctlMask) >> Descriptor->PctlShift);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	return Mode;
+}
+
+#define PORT_LOG_EVENT(SID, ERROR, PIN, OLD, NEW)    Port_LogEvent((SID), (ERROR), (PIN), (uint8)(OLD), (uint8)(NEW))
+
+#else
+
+#define PORT_LOG_EVENT(SID, ERROR, PIN, OLD, NEW)
+
+#endif
+
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+
+/*
+ * TRUE when the partition of the caller owns all the Pins of Port. Checked with
+ * or without Det, so the partitions are kept apart in every build.
+ */
+LOCAL_INLINE boolean Port_IsOwned(uint8 Port, uint32 Pins)
+{
+	Port_PartitionType Partition = PORT_GET_CURRENT_PARTITION();
+
+	return (boolean)((Partition < PORT_NUMBER_OF_PARTITIONS) && (Pins == (Port_Partitions[Partition].Pins[Port] & Pins)));
+}
+
+#endif
+
+/* The runtime services check their arguments for Det and for the error monitor */
+#if ((PORT_DEV_ERROR_DETECT == STD_ON) || (PORT_ERROR_MONITOR == STD_ON))
+#define PORT_RUNTIME_CHECKS              (STD_ON)
+#else
+#define PORT_RUNTIME_CHECKS              (STD_OFF)
+#endif
+
+#if (PORT_ERROR_MONITOR == STD_ON)
+
+/* Errors of every service since the last Port_ResetErrorCounters, kept across Port_Init calls */
+STATIC Port_ErrorStatusType Port_ErrorStatus[PORT_NUMBER_OF_SERVICES];
+
+/*
+ * Record the error a runtime service rejected its call with and pass it to Det
+ * unless the service already reported PORT_DET_RATE_LIMIT errors. The counters
+ * are updated without a lock, a preempting call may make them miss one error.
+ */
+STATIC void Port_ReportError(uint8 ServiceId, uint8 ErrorId)
+{
+	Port_ErrorStatusType * Status = &Port_ErrorStatus[ServiceId];
+
+	Status->Errors |= PORT_ERROR_BIT(ErrorId);
+
+	if(Status->Detected < 0xFFFFU){
+
+		Status->Detected++;
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+#if (PORT_DET_RATE_LIMIT != 0U)
+	if(Status->Detected > PORT_DET_RATE_LIMIT){
+
+		if(Status->Suppressed < 0xFFFFU){
+
+			Status->Suppressed++;
+		}
+
+		else{
+			/* No Action Required */
+		}
+	}
+
+	else
+#endif
+	{
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(PORT_MODULE_ID,
+				PORT_INSTANCE_ID,
+				ServiceId,
+				ErrorId);
+#endif
+	}
+}
+
+#define PORT_REPORT_ERROR(SID, ERROR)    Port_ReportError((SID), (ERROR))
+
+#elif (PORT_DEV_ERROR_DETECT == STD_ON)
+
+#define PORT_REPORT_ERROR(SID, ERROR)    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, (SID), (ERROR))
+
+#else
+
+#define PORT_REPORT_ERROR(SID, ERROR)
+
+#endif
+
+#if (PORT_WARM_RESET_CHECK == STD_ON)
+
+/* Record of the configuration the ports were last initialized with, kept across warm resets */
+typedef struct
+{
+	/* PORT_RETAINED_MAGIC once written, random after a power-on */
+	uint32 Magic;
+
+	/* Hash of the port images, see Port_ImageHash */
+	uint32 ImageHash;
+
+}Port_RetainedType;
+
+#define PORT_RETAINED_MAGIC                  (0x504F5254U)
+
+/* Not initialized by the startup code, so it survives warm resets */
+#if defined(__GNUC__) && !defined(PORT_HOST_BUILD)
+STATIC Port_RetainedType Port_Retained __attribute__((section(PORT_RETAINED_SECTION)));
+#else
+STATIC Port_RetainedType Port_Retained;
+#endif
+
+/* Ports found already programmed with their image by Port_Init, bit n for port n */
+STATIC uint32 Port_MatchingPorts = 0U;
+
+#define PORT_PORT_MATCHES(PORT)              (0U != (Port_MatchingPorts & (((uint32)1) << (PORT))))
+
+#else
+
+#define PORT_PORT_MATCHES(PORT)              (FALSE)
+
+#endif
+
+/* Pins implemented by a port of the device, bit n for pin n */
+LOCAL_INLINE uint32 Port_DevicePinsOf(uint8 Port)
+{
+	return (((uint32)1) << Port_Device[Port].NumberOfPins) - 1U;
+}
+
+#if (((PORT_CONFIG_VARIANT == PORT_VARIANT_POST_BUILD) && (PORT_CONFIG_IMAGE_SUPPORT == STD_ON)) \
+		|| (PORT_CONTEXT_API == STD_ON))
+
+/* CRC-32 (IEEE 802.3, reflected, polynomial 0xEDB88320) of one nibble */
+STATIC const uint32 Port_Crc32Nibble[16] = {
+		0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU,
+		0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+		0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU,
+		0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU
+};
+
+/* CRC-32 of Length bytes, two table lookups per byte */
+STATIC uint32 Port_Crc32(const uint8 * Data, uint32 Length)
+{
+	uint32 Crc = 0xFFFFFFFFU;
+
+	for(uint32 i = 0 ; i < Length ; i++){
+
+		Crc ^= Data[i];
+		Crc = (Crc >> 4) ^ Port_Crc32Nibble[Crc & 0x0FU];
+		Crc = (Crc >> 4) ^ Port_Crc32Nibble[Crc & 0x0FU];
+	}
+
+	return ~Crc;
+}
+
+#endif
+
+#if ((PORT_CONFIG_VARIANT == PORT_VARIANT_POST_BUILD) && (PORT_CONFIG_IMAGE_SUPPORT == STD_ON))
+
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+#define PORT_CONFIG_IMAGE_GROUPS             (PORT_NUMBER_OF_PIN_GROUPS)
+#else
+#define PORT_CONFIG_IMAGE_GROUPS             (0U)
+#endif
+
+/*
+ * Range check of every row of a configuration, so a corrupt image with a
+ * matching CRC cannot index past the port tables or program an unknown value
+ */
+STATIC boolean Port_IsConfigContentValid(const Port_ConfigType * ConfigPtr)
+{
+	boolean Valid = TRUE;
+
+	for(uint32 i = 0 ; (TRUE == Valid) && (i < PORT_NUMBER_OF_PORT_PINS) ; i++){
+
+		const Port_ConfigPin * Pin = &ConfigPtr->Pins[i];
+
+		Valid = (boolean)((Pin->Port_Num < PORT_NUMBER_OF_PORTS)
+				&& (Pin->Pin_Num < Port_Device[Pin->Port_Num].NumberOfPins)
+				&& (Pin->pin_mode <= PORT_MODE_ADC)
+				&& ((uint32)Pin->initial_value <= (uint32)PORT_PIN_LEVEL_HIGH)
+				&& ((uint32)Pin->direction <= (uint32)PORT_PIN_OUT)
+				&& ((uint32)Pin->resistance <= (uint32)PORT_RESISTANCE_OFF)
+				&& ((uint32)Pin->changeableMode <= (uint32)PORT_PIN_MODE_CHANGEABLE)
+				&& ((uint32)Pin->changeableDirection <= (uint32)PORT_PIN_DIRECTION_CHANGEABLE)
+				&& ((uint32)Pin->interrupt <= (uint32)PORT_PIN_INTERRUPT_HIGH_LEVEL)
+				&& ((uint32)Pin->drive <= (uint32)PORT_PIN_DRIVE_8MA)
+				&& ((uint32)Pin->slewRate <= (uint32)PORT_PIN_SLEW_RATE_CONTROLLED)
+				&& ((uint32)Pin->outputType <= (uint32)PORT_PIN_OUTPUT_OPEN_DRAIN)
+				&& ((uint32)Pin->trigger <= (uint32)PORT_PIN_TRIGGER_ADC_AND_DMA)
+				&& ((uint32)Pin->priority <= (uint32)PORT_PIN_PRIORITY_CRITICAL));
+	}
+
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+	for(uint32 Group = 0 ; (TRUE == Valid) && (Group < PORT_NUMBER_OF_PIN_GROUPS) ; Group++){
+
+		const Port_ConfigGroup * Entry = &ConfigPtr->Groups[Group];
+
+		Valid = (boolean)((Entry->Port < PORT_NUMBER_OF_PORTS)
+				&& (0U != Entry->Pins)
+				&& (0U == (Entry->Pins & ~Port_DevicePinsOf(Entry->Port))));
+	}
+#endif
+
+#if (PORT_MODE_PROFILE_API == STD_ON)
+	for(uint32 Profile = 0 ; (TRUE == Valid) && (Profile < PORT_NUMBER_OF_MODE_PROFILES) ; Profile++){
+
+		const Port_ConfigProfile * Entry = &ConfigPtr->Profiles[Profile];
+
+		Valid = (boolean)(Entry->Mode <= PORT_MODE_ADC);
+
+		for(uint8 Port = PORT_PORTA_ID ; (TRUE == Valid) && (Port < PORT_NUMBER_OF_PORTS) ; Port++){
+
+			Valid = (boolean)(0U == (Entry->Pins[Port] & ~Port_DevicePinsOf(Port)));
+		}
+	}
+#endif
+
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+	for(uint32 Partition = 0 ; (TRUE == Valid) && (Partition < PORT_NUMBER_OF_PARTITIONS) ; Partition++){
+
+		for(uint8 Port = PORT_PORTA_ID ; (TRUE == Valid) && (Port < PORT_NUMBER_OF_PORTS) ; Port++){
+
+			Valid = (boolean)(0U == (ConfigPtr->Partitions[Partition].Pins[Port] & ~Port_DevicePinsOf(Port)));
+		}
+	}
+#endif
+
+	return Valid;
+}
+
+/*
+ * Check the image around a configuration before Port_Init reads it in place.
+ * The linked Port_Configuration was checked by the compiler and has no header.
+ */
+STATIC boolean Port_IsConfigImageValid(const Port_ConfigType * ConfigPtr)
+{
+	boolean Valid = TRUE;
+
+	if(NULL_PTR == ConfigPtr){
+
+		Valid = FALSE;
+	}
+
+	else if(&Port_Configuration != ConfigPtr){
+
+		const Port_ConfigImageHeaderType * Header =
+				&((const Port_ConfigImageType *)(const void *)((const uint8 *)ConfigPtr - offsetof(Port_ConfigImageType, Config)))->Header;
+
+		Valid = (boolean)((PORT_CONFIG_IMAGE_MAGIC == Header->Magic)
+				&& (PORT_CONFIG_IMAGE_FORMAT_VERSION == Header->FormatVersion)
+				&& (PORT_SW_MAJOR_VERSION == Header->SwMajorVersion)
+				&& (PORT_SW_MINOR_VERSION == Header->SwMinorVersion)
+				&& (PORT_SW_PATCH_VERSION == Header->SwPatchVersion)
+				&& (PORT_AR_RELEASE_MAJOR_VERSION == Header->ArMajorVersion)
+				&& (PORT_AR_RELEASE_MINOR_VERSION == Header->ArMinorVersion)
+				&& (PORT_AR_RELEASE_PATCH_VERSION == Header->ArPatchVersion)
+				&& (PORT_NUMBER_OF_PORT_PINS == Header->PinCount)
+				&& (PORT_CONFIG_IMAGE_GROUPS == Header->GroupCount)
+				&& (sizeof(Port_ConfigType) == Header->PayloadSize)
+				&& (Port_Crc32((const uint8 *)ConfigPtr, sizeof(Port_ConfigType)) == Header->Crc)
+				&& (TRUE == Port_IsConfigContentValid(ConfigPtr)));
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	return Valid;
+}
+
+#endif
+
+#if (PORT_CONTEXT_API == STD_ON)
+
+/*
+ * Check a context before Port_RestoreContext writes it: the retained memory may
+ * not have survived the hibernation, or hold a context of another driver build
+ */
+STATIC boolean Port_IsContextValid(const Port_ContextType * Context)
+{
+	boolean Valid = (boolean)((NULL_PTR != Context)
+			&& (PORT_CONTEXT_MAGIC == Context->Magic)
+			&& (PORT_CONTEXT_FORMAT_VERSION == Context->FormatVersion)
+			&& (Port_Crc32((const uint8 *)Context, offsetof(Port_ContextType, Crc)) == Context->Crc));
+
+#if (PORT_CONFIG_VARIANT == PORT_VARIANT_POST_BUILD)
+
+	/* The configuration is read again to rebuild the driver state, as by Port_Init */
+	if((TRUE == Valid) && (NULL_PTR == Context->ConfigPtr)){
+
+		Valid = FALSE;
+	}
+
+#if (PORT_CONFIG_IMAGE_SUPPORT == STD_ON)
+	else if((TRUE == Valid) && (FALSE == Port_IsConfigImageValid(Context->ConfigPtr))){
+
+		Valid = FALSE;
+	}
+#endif
+
+	else{
+		/* No Action Required */
+	}
+
+#endif
+
+	return Valid;
+}
+
+#endif
+
+#if (PORT_CONFIG_VARIANT == PORT_VARIANT_POST_BUILD)
+
+/* Build the register image of every port and the runtime descriptor of every pin from the configured pins */
+STATIC void Port_BuildPortImages(void)
+{
+	for(uint8 Port = PORT_PORTA_ID ; Port < PORT_NUMBER_OF_PORTS ; Port++){
+
+		Port_PortImages[Port] = (Port_PortImageType){0};
+	}
+
+	for(Port_PinType i = PORT_PIN0_ID ; i < PORT_NUMBER_OF_PORT_PINS ; i++){
+
+		Port_PortImageType * Image = &Port_PortImages[Port_Pins[i].Port_Num];
+		Port_PinDescriptorType * Descriptor = &Port_PinDescriptors[i];
+		uint32 PinBit = ((uint32)1) << Port_Pins[i].Pin_Num;
+
+		Image->PinMask |= PinBit;
+		Image->PctlMask |= ((uint32)0x0F) << (4 * Port_Pins[i].Pin_Num);
+
+		if(PORT_PIN_PRIORITY_CRITICAL == Port_Pins[i].priority){
+
+			Image->CriticalMask |= PinBit;
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		Descriptor->Base = Port_Device[Port_Pins[i].Port_Num].BaseAddress;
+		Descriptor->PctlMask = ((uint32)0x0F) << (4 * Port_Pins[i].Pin_Num);
+		Descriptor->PinBit = (uint8)PinBit;
+		Descriptor->PctlShift = (uint8)(4 * Port_Pins[i].Pin_Num);
+		Descriptor->Port = Port_Pins[i].Port_Num;
+		Descriptor->Flags = 0U;
+
+		if(PORT_PIN_DIRECTION_CHANGEABLE == Port_Pins[i].changeableDirection){
+
+			Descriptor->Flags |= PORT_PIN_FLAG_DIRECTION_CHANGEABLE;
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		if(PORT_PIN_MODE_CHANGEABLE == Port_Pins[i].changeableMode){
+
+			Descriptor->Flags |= PORT_PIN_FLAG_MODE_CHANGEABLE;
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		if(0U != (Port_Device[Port_Pins[i].Port_Num].AnalogPins & PinBit)){
+
+			Descriptor->Flags |= PORT_PIN_FLAG_ANALOG;
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		/* Digital or analog */
+		if(Port_Pins[i].pin_mode == PORT_MODE_ADC){
+
+			Image->Amsel |= PinBit;
+		}
+
+		else{
+
+			Image->Den |= PinBit;
+		}
+
+		/* Alternate function */
+		switch(Port_Pins[i].pin_mode){
+
+		case PORT_MODE_DIO:
+		case PORT_MODE_ADC:
+			break;
+
+		default:
+
+			Image->Afsel |= PinBit;
+			Image->Pctl |= ((uint32)Port_Pins[i].pin_mode) << (4 * Port_Pins[i].Pin_Num);
+		}
+
+		/* Direction, initial value and internal resistances */
+		if(Port_Pins[i].direction == PORT_PIN_OUT){
+
+			Image->Dir |= PinBit;
+			Image->OutputMask |= PinBit;
+
+			if(Port_Pins[i].initial_value == PORT_PIN_LEVEL_HIGH){
+
+				Image->Data |= PinBit;
+			}
+
+			else{
+				/* No Action Required */
+			}
+		}
+
+		else if(Port_Pins[i].resistance == PORT_RESISTANCE_PULL_UP){
+
+			Image->Pur |= PinBit;
+		}
+
+		else if(Port_Pins[i].resistance == PORT_RESISTANCE_PULL_DOWN){
+
+			Image->Pdr |= PinBit;
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		if(PORT_PIN_DIRECTION_NON_CHANGEABLE == Port_Pins[i].changeableDirection){
+
+			Image->RefreshMask |= PinBit;
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		/* Drive strength, slew rate and output type */
+		switch(Port_Pins[i].drive){
+
+		case PORT_PIN_DRIVE_4MA:
+
+			Image->Dr4r |= PinBit;
+			break;
+
+		case PORT_PIN_DRIVE_8MA:
+
+			Image->Dr8r |= PinBit;
+
+			if(Port_Pins[i].slewRate == PORT_PIN_SLEW_RATE_CONTROLLED){
+
+				Image->Slr |= PinBit;
+			}
+
+			else{
+				/* No Action Required */
+			}
+			break;
+
+		default:
+
+			Image->Dr2r |= PinBit;
+		}
+
+		if(Port_Pins[i].outputType == PORT_PIN_OUTPUT_OPEN_DRAIN){
+
+			Image->Odr |= PinBit;
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		/* Hardware triggers */
+		if((Port_Pins[i].trigger == PORT_PIN_TRIGGER_ADC) || (Port_Pins[i].trigger == PORT_PIN_TRIGGER_ADC_AND_DMA)){
+
+			Image->Adcctl |= PinBit;
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		if((Port_Pins[i].trigger == PORT_PIN_TRIGGER_DMA) || (Port_Pins[i].trigger == PORT_PIN_TRIGGER_ADC_AND_DMA)){
+
+			Image->Dmactl |= PinBit;
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		/* Interrupt sense: IS selects level, IBE both edges, IEV rising edge or high level */
+		switch(Port_Pins[i].interrupt){
+
+		case PORT_PIN_INTERRUPT_RISING_EDGE:
+
+			Image->Iev |= PinBit;
+			Image->Im |= PinBit;
+			break;
+
+		case PORT_PIN_INTERRUPT_FALLING_EDGE:
+
+			Image->Im |= PinBit;
+			break;
+
+		case PORT_PIN_INTERRUPT_BOTH_EDGES:
+
+			Image->Ibe |= PinBit;
+			Image->Im |= PinBit;
+			break;
+
+		case PORT_PIN_INTERRUPT_LOW_LEVEL:
+
+			Image->Is |= PinBit;
+			Image->Im |= PinBit;
+			break;
+
+		case PORT_PIN_INTERRUPT_HIGH_LEVEL:
+
+			Image->Is |= PinBit;
+			Image->Iev |= PinBit;
+			Image->Im |= PinBit;
+			break;
+
+		default:
+			break;
+		}
+	}
+}
+
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+
+/*
+ * Build the runtime descriptor of every pin group from the port images. A group
+ * with a pin that is not configured as direction changeable is reported and
+ * left without pins, so Port_SetGroupDirection rejects it.
+ */
+STATIC void Port_BuildGroupDescriptors(void)
+{
+	for(Port_GroupType Group = 0U ; Group < PORT_NUMBER_OF_PIN_GROUPS ; Group++){
+
+		const Port_ConfigGroup * Config = &Port_ConfigPtr->Groups[Group];
+		Port_GroupDescriptorType * Descriptor = &Port_GroupDescriptors[Group];
+		uint32 Changeable = 0U;
+
+		if(Config->Port < PORT_NUMBER_OF_PORTS){
+
+			Changeable = Port_PortImages[Config->Port].PinMask & ~Port_PortImages[Config->Port].RefreshMask;
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		if((0U != Config->Pins) && (0U == (Config->Pins & ~Changeable))){
+
+			Descriptor->Base = Port_Device[Config->Port].BaseAddress;
+			Descriptor->Pins = Config->Pins;
+			Descriptor->Port = Config->Port;
+		}
+
+		else{
+
+			Descriptor->Base = 0U;
+			Descriptor->Pins = 0U;
+			Descriptor->Port = 0U;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+			Det_ReportError(PORT_MODULE_ID,
+					PORT_INSTANCE_ID,
+					PORT_INIT_SID,
+					PORT_E_PARAM_CONFIG);
+#endif
+		}
+	}
+}
+
+#endif
+
+#endif
+
+/* Enable the clock of all the configured ports at once, the read back
+ * gives the clocks time to start before the first port access */
+STATIC void Port_EnableClocks(void)
+{
+#if (PORT_CONFIG_VARIANT == PORT_VARIANT_PRE_COMPILE)
+
+	uint32 ConfiguredPorts = PORT_PC_CONFIGURED_PORTS;
+
+#else
+
+	uint32 ConfiguredPorts = 0;
+
+	for(uint8 Port = PORT_PORTA_ID ; Port < PORT_NUMBER_OF_PORTS ; Port++){
+
+		if(Port_PortImages[Port].PinMask != 0){
+
+			ConfiguredPorts |= ((uint32)1) << Port;
+		}
+
+		else{
+			/* No Action Required */
+		}
+	}
+
+#endif
+
+	PORT_REG_MODIFY(PORT_CLOCK_GATING_REG_ADDRESS, ConfiguredPorts, ConfiguredPorts);
+	(void)PORT_REG_READ(PORT_CLOCK_GATING_REG_ADDRESS);
+}
+
+/* Nibbles of GPIOPCTL owned by the pins of Mask, bit n spread to bits 4n..4n+3 */
+LOCAL_INLINE uint32 Port_PctlMaskOf(uint32 Mask)
+{
+	uint32 Nibbles = Mask & 0xFFU;
+
+	Nibbles = (Nibbles | (Nibbles << 12)) & 0x000F000FU;
+	Nibbles = (Nibbles | (Nibbles << 6)) & 0x03030303U;
+	Nibbles = (Nibbles | (Nibbles << 3)) & 0x11111111U;
+
+	return Nibbles * 0x0FU;
+}
+
+#if (PORT_MODE_PROFILE_API == STD_ON)
+
+/*
+ * Precompute the register values of every mode profile on each of its ports, and
+ * the registers a switch between two profiles of the same pins has to write. A
+ * profile without pins, or with a pin that is not mode changeable or cannot take
+ * the mode, is reported and left without ports, so Port_SetModeProfile rejects it.
+ */
+STATIC void Port_BuildModeProfiles(const Port_ConfigProfile * Profiles)
+{
+	uint32 Changeable[PORT_NUMBER_OF_PORTS] = {0U};
+	uint32 Analog[PORT_NUMBER_OF_PORTS] = {0U};
+	uint16 Next = 0U;
+
+	for(uint32 Pin = 0U ; Pin < PORT_NUMBER_OF_PORT_PINS ; Pin++){
+
+		const Port_PinDescriptorType * Descriptor = &Port_PinDescriptors[Pin];
+
+		if(0U != (Descriptor->Flags & PORT_PIN_FLAG_MODE_CHANGEABLE)){
+
+			Changeable[Descriptor->Port] |= Descriptor->PinBit;
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		if(0U != (Descriptor->Flags & PORT_PIN_FLAG_ANALOG)){
+
+			Analog[Descriptor->Port] |= Descriptor->PinBit;
+		}
+
+		else{
+			/* No Action Required */
+		}
+	}
+
+	for(uint32 Profile = 0U ; Profile < PORT_NUMBER_OF_MODE_PROFILES ; Profile++){
+
+		Port_PinModeType Mode = Profiles[Profile].Mode;
+		boolean Alternate = (boolean)((PORT_MODE_DIO != Mode) && (PORT_MODE_ADC != Mode));
+		boolean Valid = (boolean)(Mode <= PORT_MODE_ADC);
+		uint16 First = Next;
+
+		for(uint8 Port = PORT_PORTA_ID ; Port < PORT_NUMBER_OF_PORTS ; Port++){
+
+			uint32 Pins = Profiles[Profile].Pins[Port];
+			uint32 Allowed = (PORT_MODE_ADC == Mode) ? (Changeable[Port] & Analog[Port]) : Changeable[Port];
+
+			if(0U != Pins){
+
+				Port_ProfilePortType * Entry = &Port_ProfilePorts[Next];
+
+				Entry->Base = Port_Device[Port].BaseAddress;
+				Entry->Pins = Pins;
+				Entry->PctlMask = Port_PctlMaskOf(Pins);
+				Entry->Amsel = (PORT_MODE_ADC == Mode) ? Pins : 0U;
+				Entry->Den = (PORT_MODE_ADC == Mode) ? 0U : Pins;
+				Entry->Afsel = (TRUE == Alternate) ? Pins : 0U;
+				Entry->Pctl = (TRUE == Alternate) ? (Entry->PctlMask & ((uint32)Mode * 0x11111111U)) : 0U;
+				Entry->Port = Port;
+
+				Next++;
+
+				if(0U != (Pins & ~Allowed)){
+
+					Valid = FALSE;
+				}
+
+				else{
+					/* No Action Required */
+				}
+			}
+
+			else{
+				/* No Action Required */
+			}
+		}
+
+		if((TRUE == Valid) && (Next != First)){
+
+			Port_ProfileDescriptors[Profile].First = First;
+			Port_ProfileDescriptors[Profile].Count = (uint16)(Next - First);
+		}
+
+		else{
+
+			Port_ProfileDescriptors[Profile].First = First;
+			Port_ProfileDescriptors[Profile].Count = 0U;
+			Next = First;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+			Det_ReportError(PORT_MODULE_ID,
+					PORT_INSTANCE_ID,
+					PORT_INIT_SID,
+					PORT_E_PARAM_CONFIG);
+#endif
+		}
+	}
+
+	/* Profiles of the same pins on the same ports only write the registers whose values differ */
+	for(uint32 From = 0U ; From < PORT_NUMBER_OF_MODE_PROFILES ; From++){
+
+		for(uint32 To = 0U ; To < PORT_NUMBER_OF_MODE_PROFILES ; To++){
+
+			const Port_ProfileDescriptorType * Source = &Port_ProfileDescriptors[From];
+			const Port_ProfileDescriptorType * Target = &Port_ProfileDescriptors[To];
+			uint8 Registers = 0U;
+
+			if(Source->Count != Target->Count){
+
+				Registers = PORT_PROFILE_REG_ALL;
+			}
+
+			else{
+
+				for(uint16 i = 0U ; i < Target->Count ; i++){
+
+					const Port_ProfilePortType * Old = &Port_ProfilePorts[Source->First + i];
+					const Port_ProfilePortType * New = &Port_ProfilePorts[Target->First + i];
+
+					if((Old->Port != New->Port) || (Old->Pins != New->Pins)){
+
+						Registers = PORT_PROFILE_REG_ALL;
+					}
+
+					else{
+
+						Registers |= (Old->Amsel != New->Amsel) ? PORT_PROFILE_REG_AMSEL : 0U;
+						Registers |= (Old->Den != New->Den) ? PORT_PROFILE_REG_DEN : 0U;
+						Registers |= (Old->Pctl != New->Pctl) ? PORT_PROFILE_REG_PCTL : 0U;
+						Registers |= (Old->Afsel != New->Afsel) ? PORT_PROFILE_REG_AFSEL : 0U;
+					}
+				}
+			}
+
+			Port_ProfileDeltas[From][To] = Registers;
+		}
+	}
+}
+
+#endif
+
+#if ((PORT_WARM_RESET_CHECK == STD_ON) || (PORT_INIT_VERIFICATION == STD_ON))
+
+/* Pins of a port that can be read back, the reserved pins never take their image (see Port_ApplyPortImage) */
+#define PORT_READBACK_PINS(PORT)             (Port_PortImages[PORT].PinMask & ~((uint32)Port_Device[PORT].ReservedPins))
+
+/*
+ * Read back GPIODEN, GPIOAMSEL, GPIOAFSEL, GPIOPCTL, GPIODIR, GPIOPUR and GPIOPDR
+ * of one port, one read per register. Non zero when one of them differs from the image.
+ */
+STATIC uint32 Port_ReadBackPinConfiguration(uint8 Port)
+{
+	const Port_PortImageType * Image = &Port_PortImages[Port];
+	uint32 Base = Port_Device[Port].BaseAddress;
+	uint32 PinMask = PORT_READBACK_PINS(Port);
+	uint32 Mismatch = (PORT_REG_READ(GPIO_REG(Base, GPIO_DEN_REG_OFFSET)) ^ Image->Den) & PinMask;
+
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_AMSEL_REG_OFFSET)) ^ Image->Amsel) & PinMask;
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_AFSEL_REG_OFFSET)) ^ Image->Afsel) & PinMask;
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_PCTL_REG_OFFSET)) ^ Image->Pctl) & Port_PctlMaskOf(PinMask);
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_DIR_REG_OFFSET)) ^ Image->Dir) & PinMask;
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_PUR_REG_OFFSET)) ^ Image->Pur) & PinMask;
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_PDR_REG_OFFSET)) ^ Image->Pdr) & PinMask;
+
+	return Mismatch;
+}
+
+#endif
+
+#if (PORT_INIT_VERIFICATION == STD_ON)
+
+/* Ports whose pin configuration did not read back at the last Port_Init or Port_RestoreContext, bit n for port n */
+STATIC uint32 Port_VerificationFailures = 0U;
+
+/* Read back every configured port once it is programmed, a failing port is reported to Det */
+STATIC void Port_VerifyPorts(void)
+{
+	Port_VerificationFailures = 0U;
+
+	for(uint8 Port = PORT_PORTA_ID ; Port < PORT_NUMBER_OF_PORTS ; Port++){
+
+		if((Port_PortImages[Port].PinMask != 0) && (0U != Port_ReadBackPinConfiguration(Port))){
+
+			Port_VerificationFailures |= ((uint32)1) << Port;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+			Det_ReportError(PORT_MODULE_ID,
+					PORT_INSTANCE_ID,
+					PORT_INIT_SID,
+					PORT_E_INIT_FAILED);
+#endif
+		}
+
+		else{
+			/* No Action Required */
+		}
+	}
+}
+
+#if (PORT_CONTEXT_API == STD_ON)
+
+/* Read back the registers of Port_ReadBackPinConfiguration against a restored context, non zero when one differs */
+STATIC uint32 Port_ReadBackContext(uint8 Port, const Port_PortContextType * Saved)
+{
+	uint32 Base = Port_Device[Port].BaseAddress;
+	uint32 PinMask = PORT_READBACK_PINS(Port);
+	uint32 Mismatch = (PORT_REG_READ(GPIO_REG(Base, GPIO_DEN_REG_OFFSET)) ^ Saved->Den) & PinMask;
+
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_AMSEL_REG_OFFSET)) ^ Saved->Amsel) & PinMask;
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_AFSEL_REG_OFFSET)) ^ Saved->Afsel) & PinMask;
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_PCTL_REG_OFFSET)) ^ Saved->Pctl) & Port_PctlMaskOf(PinMask);
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_DIR_REG_OFFSET)) ^ Saved->Dir) & PinMask;
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_PUR_REG_OFFSET)) ^ Saved->Pur) & PinMask;
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_PDR_REG_OFFSET)) ^ Saved->Pdr) & PinMask;
+
+	return Mismatch;
+}
+
+#endif
+
+#endif
+
+#if (PORT_WARM_RESET_CHECK == STD_ON)
+
+/* FNV-1a hash of the port images, which follow from the configuration without padding bytes */
+STATIC uint32 Port_ImageHash(void)
+{
+	const uint32 * Word = (const uint32 *)Port_PortImages;
+	uint32 Hash = 0x811C9DC5U;
+
+	for(uint32 i = 0 ; i < (PORT_NUMBER_OF_PORTS * (sizeof(Port_PortImageType) / sizeof(uint32))) ; i++){
+
+		Hash = (Hash ^ Word[i]) * 0x01000193U;
+	}
+
+	return Hash;
+}
+
+/* Read back one port, one read per register, TRUE when it already holds its image */
+STATIC boolean Port_PortMatchesImage(uint8 Port)
+{
+	const Port_PortImageType * Image = &Port_PortImages[Port];
+	uint32 Base = Port_Device[Port].BaseAddress;
+	uint32 PinMask = PORT_READBACK_PINS(Port);
+	uint32 OutputMask = Image->OutputMask & PinMask;
+	uint32 InterruptMask = PORT_REG_READ(GPIO_REG(Base, GPIO_IM_REG_OFFSET));
+	uint32 Mismatch = (InterruptMask ^ Image->Im) & PinMask;
+
+	Mismatch |= Port_ReadBackPinConfiguration(Port);
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_DR2R_REG_OFFSET)) ^ Image->Dr2r) & PinMask;
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_DR4R_REG_OFFSET)) ^ Image->Dr4r) & PinMask;
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_DR8R_REG_OFFSET)) ^ Image->Dr8r) & PinMask;
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_SLR_REG_OFFSET)) ^ Image->Slr) & PinMask;
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_ODR_REG_OFFSET)) ^ Image->Odr) & PinMask;
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_IS_REG_OFFSET)) ^ Image->Is) & PinMask;
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_IBE_REG_OFFSET)) ^ Image->Ibe) & PinMask;
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_IEV_REG_OFFSET)) ^ Image->Iev) & PinMask;
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_ADCCTL_REG_OFFSET)) ^ Image->Adcctl) & PinMask;
+	Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_DMACTL_REG_OFFSET)) ^ Image->Dmactl) & PinMask;
+
+	/* The output pins still at their initial level */
+	if(OutputMask != 0){
+
+		Mismatch |= (PORT_REG_READ(GPIO_REG(Base, GPIO_DATA_MASKED_OFFSET(OutputMask))) ^ Image->Data) & OutputMask;
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	/* A skipped port keeps its interrupt mask, the shadow must follow it */
+	Port_InterruptMasks[Port] = InterruptMask;
+
+	return (0U == Mismatch) ? TRUE : FALSE;
+}
+
+/*
+ * Find the ports a warm reset left programmed with the current configuration.
+ * After a power-on, or with another configuration, the retained record does
+ * not match and no port is read back.
+ */
+STATIC void Port_CheckWarmReset(void)
+{
+	uint32 Hash = Port_ImageHash();
+
+	Port_MatchingPorts = 0U;
+
+	if((PORT_RETAINED_MAGIC == Port_Retained.Magic) && (Hash == Port_Retained.ImageHash)){
+
+		for(uint8 Port = PORT_PORTA_ID ; Port < PORT_NUMBER_OF_PORTS ; Port++){
+
+			if((Port_PortImages[Port].PinMask != 0) && (TRUE == Port_PortMatchesImage(Port))){
+
+				Port_MatchingPorts |= ((uint32)1) << Port;
+			}
+
+			else{
+				/* No Action Required */
+			}
+		}
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	/* A reset while the ports are programmed is caught by the read back of the next warm reset */
+	Port_Retained.Magic = PORT_RETAINED_MAGIC;
+	Port_Retained.ImageHash = Hash;
+}
+
+#endif
+
+/*
+ * Write the bits of Mask of a port register. A mask covering every pin of the port is a
+ * plain store of the value, with no read: in the pre-compile variant both masks are
+ * constants and only the store is left.
+ */
+PORT_APPLY_INLINE void Port_WritePortReg(uint32 Address, uint32 Mask, uint32 PortMask, uint32 Value)
+{
+	if(Mask == PortMask){
+
+		PORT_REG_WRITE(Address, Value);
+	}
+
+	else{
+
+		PORT_REG_MODIFY(Address, Mask, Value);
+	}
+}
+
+/* Program the pins of Mask of one port from its register image, one access per register */
+PORT_APPLY_INLINE void Port_ApplyPortImage(uint8 Port, uint32 Mask)
+{
+	const Port_PortImageType * Image = &Port_PortImages[Port];
+	uint32 Base = Port_Device[Port].BaseAddress;
+	uint32 PortMask = Port_DevicePinsOf(Port);
+	uint32 PinMask = Image->PinMask & Mask;
+	uint32 PctlMask = Image->PctlMask & Port_PctlMaskOf(Mask);
+	uint32 UnlockMask = PinMask & Port_Device[Port].LockedPins;
+	uint32 OutputMask = Image->OutputMask & Mask;
+	uint32 Dr2r = Image->Dr2r & Mask;
+	uint32 Dr4r = Image->Dr4r & Mask;
+	uint32 Dr8r = Image->Dr8r & Mask;
+	uint32 Pur = Image->Pur & Mask;
+	uint32 Pdr = Image->Pdr & Mask;
+	uint32 Im = Image->Im & Mask;
+
+	/*Step 1 : Unlock the locked pins*/
+	if(UnlockMask != 0){
+
+		PORT_REG_WRITE(GPIO_REG(Base, GPIO_LOCK_REG_OFFSET), UNLOCKING_VALUE);
+
+		PORT_REG_MODIFY(GPIO_REG(Base, GPIO_CR_REG_OFFSET), UnlockMask, UnlockMask);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	/*Step 2 : Set digital or analog*/
+	Port_WritePortReg(GPIO_REG(Base, GPIO_AMSEL_REG_OFFSET), PinMask, PortMask, Image->Amsel);
+	Port_WritePortReg(GPIO_REG(Base, GPIO_DEN_REG_OFFSET), PinMask, PortMask, Image->Den);
+
+	/*Step 3 : Set the Alternate function*/
+	Port_WritePortReg(GPIO_REG(Base, GPIO_PCTL_REG_OFFSET), PctlMask, Port_PctlMaskOf(PortMask), Image->Pctl);
+	Port_WritePortReg(GPIO_REG(Base, GPIO_AFSEL_REG_OFFSET), PinMask, PortMask, Image->Afsel);
+
+	/*Step 4 : Set the drive strength, slew rate and output type*/
+	if(Dr2r != 0){
+
+		PORT_REG_MODIFY(GPIO_REG(Base, GPIO_DR2R_REG_OFFSET), Dr2r, Dr2r);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	if(Dr4r != 0){
+
+		PORT_REG_MODIFY(GPIO_REG(Base, GPIO_DR4R_REG_OFFSET), Dr4r, Dr4r);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	if(Dr8r != 0){
+
+		PORT_REG_MODIFY(GPIO_REG(Base, GPIO_DR8R_REG_OFFSET), Dr8r, Dr8r);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	Port_WritePortReg(GPIO_REG(Base, GPIO_SLR_REG_OFFSET), PinMask, PortMask, Image->Slr);
+	Port_WritePortReg(GPIO_REG(Base, GPIO_ODR_REG_OFFSET), PinMask, PortMask, Image->Odr);
+
+	/*Step 5 : Set the Direction of the pins*/
+	Port_WritePortReg(GPIO_REG(Base, GPIO_DIR_REG_OFFSET), PinMask, PortMask, Image->Dir);
+
+	/*Step 6 : Set the initial value of the output pins, one store through the masked GPIODATA alias*/
+	if(OutputMask != 0){
+
+		PORT_REG_WRITE(GPIO_REG(Base, GPIO_DATA_MASKED_OFFSET(OutputMask)), Image->Data);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	/*Step 7 : Configure Internal Resistances of the input pins*/
+	if(Pur != 0){
+
+		PORT_REG_MODIFY(GPIO_REG(Base, GPIO_PUR_REG_OFFSET), Pur, Pur);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	if(Pdr != 0){
+
+		PORT_REG_MODIFY(GPIO_REG(Base, GPIO_PDR_REG_OFFSET), Pdr, Pdr);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	/*Step 8 : Configure the interrupt sense of every pin, the armed pins masked while it changes*/
+	{
+		uint32 ArmedMask = PORT_REG_READ(GPIO_REG(Base, GPIO_IM_REG_OFFSET));
+		uint32 InterruptMask = ArmedMask & ~PinMask;
+
+		if(InterruptMask != ArmedMask){
+
+			PORT_REG_WRITE(GPIO_REG(Base, GPIO_IM_REG_OFFSET), InterruptMask);
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		/* Pins without an interrupt get the reset sense back, whatever was set before */
+		Port_WritePortReg(GPIO_REG(Base, GPIO_IS_REG_OFFSET), PinMask, PortMask, Image->Is);
+		Port_WritePortReg(GPIO_REG(Base, GPIO_IBE_REG_OFFSET), PinMask, PortMask, Image->Ibe);
+		Port_WritePortReg(GPIO_REG(Base, GPIO_IEV_REG_OFFSET), PinMask, PortMask, Image->Iev);
+
+		if(Im != 0){
+
+			/* Drop the edges latched while the sense was changing */
+			PORT_REG_WRITE(GPIO_REG(Base, GPIO_ICR_REG_OFFSET), Im);
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		InterruptMask |= Im;
+
+		PORT_REG_WRITE(GPIO_REG(Base, GPIO_IM_REG_OFFSET), InterruptMask);
+
+		Port_InterruptMasks[Port] = InterruptMask;
+	}
+
+	/*Step 9 : Route the ADC and uDMA triggers, once the interrupt sense is set*/
+	Port_WritePortReg(GPIO_REG(Base, GPIO_ADCCTL_REG_OFFSET), PinMask, PortMask, Image->Adcctl);
+	Port_WritePortReg(GPIO_REG(Base, GPIO_DMACTL_REG_OFFSET), PinMask, PortMask, Image->Dmactl);
+}
+
+/* Program the critical pins of one port, or its other pins */
+PORT_APPLY_INLINE void Port_ApplyPortPhase(uint8 Port, boolean Critical)
+{
+	uint32 Mask = Port_PortImages[Port].CriticalMask;
+
+	if(FALSE == Critical){
+
+		Mask = Port_PortImages[Port].PinMask & ~Mask;
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	if((Mask != 0) && (FALSE == PORT_PORT_MATCHES(Port))){
+
+		Port_ApplyPortImage(Port, Mask);
+	}
+
+	else{
+		/* No Action Required */
+	}
+}
+
+/* Program the critical pins of every port, or their other pins */
+PORT_APPLY_INLINE void Port_ApplyPhase(boolean Critical)
+{
+#if (PORT_CONFIG_VARIANT == PORT_VARIANT_PRE_COMPILE)
+
+	/* One constant image per port, no loop over the pins or the ports */
+	PORT_DEVICE_PORT_LIST(PORT_PC_APPLY_PORT, Critical)
+#else
+
+	for(uint8 Port = PORT_PORTA_ID ; Port < PORT_NUMBER_OF_PORTS ; Port++){
+
+		Port_ApplyPortPhase(Port, Critical);
+	}
+
+#endif
+}
+
+#if (PORT_DEFERRED_INIT == STD_ON)
+
+/* Next port whose other pins than the critical ones are left to program */
+STATIC uint8 Port_InitCursor = PORT_PORTA_ID;
+
+/*
+ * Program the other pins than the critical ones of at most MaxPorts ports,
+ * from the cursor on. Ports without such pins are skipped without counting.
+ * The driver is initialized once the last port is done.
+ */
+STATIC void Port_ApplyDeferredPorts(uint8 MaxPorts)
+{
+	uint8 Port = Port_InitCursor;
+	uint8 AppliedPorts = 0U;
+	boolean SliceDone = FALSE;
+
+	while((Port < PORT_NUMBER_OF_PORTS) && (FALSE == SliceDone)){
+
+		uint32 Mask = Port_PortImages[Port].PinMask & ~Port_PortImages[Port].CriticalMask;
+
+		if((0U == Mask) || (TRUE == PORT_PORT_MATCHES(Port))){
+
+			Port++;
+		}
+
+		else if(AppliedPorts < MaxPorts){
+
+			Port_ApplyPortImage(Port, Mask);
+
+			AppliedPorts++;
+			Port++;
+		}
+
+		else{
+
+			SliceDone = TRUE;
+		}
+	}
+
+	Port_InitCursor = Port;
+
+	if(Port >= PORT_NUMBER_OF_PORTS){
+
+#if (PORT_INIT_VERIFICATION == STD_ON)
+		Port_VerifyPorts();
+#endif
+
+		Port_Status = PORT_INITIALIZED;
+	}
+
+	else{
+		/* No Action Required */
+	}
+}
+
+#endif
+
+/*
+ * RAM state of the driver built from its configuration, by Port_Init and again
+ * by Port_RestoreContext as a hibernation may have lost it. ConfigPtr is unused
+ * in the pre-compile variant.
+ */
+STATIC void Port_BuildDriverState(const Port_ConfigType * ConfigPtr)
+{
+#if (PORT_CONFIG_VARIANT == PORT_VARIANT_POST_BUILD)
+
+	Port_ConfigPtr = ConfigPtr;
+	Port_Pins = ConfigPtr->Pins;
+
+	Port_BuildPortImages();
+
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+	Port_BuildGroupDescriptors();
+#endif
+
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+	Port_Partitions = ConfigPtr->Partitions;
+#endif
+
+#else
+
+	(void)ConfigPtr;
+
+#endif
+
+#if (PORT_MODE_PROFILE_API == STD_ON)
+
+#if (PORT_CONFIG_VARIANT == PORT_VARIANT_PRE_COMPILE)
+	Port_BuildModeProfiles(Port_PrecompileProfiles);
+#else
+	Port_BuildModeProfiles(ConfigPtr->Profiles);
+#endif
+
+	/* The pins hold the modes of no known profile */
+	Port_ActiveProfile = PORT_PROFILE_NONE;
+
+#endif
+}
+
+/************************************************************************************
+ * Service Name: Port_Init
+ * Service ID[hex]: 0x00
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): ConfigPtr - Pointer to post-build configuration data
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to Initialize the Port module. The critical pins of all
+ *              the ports are programmed first, the other pins are programmed
+ *              next or, with PORT_DEFERRED_INIT, by Port_MainFunction and
+ *              Port_CompleteInit.
+ ************************************************************************************/
+void Port_Init(const Port_ConfigType * ConfigPtr)
+{
+
+	boolean Error = FALSE ;
+
+#if (PORT_CONFIG_VARIANT == PORT_VARIANT_PRE_COMPILE)
+
+	/* The pins come from PORT_PRECOMPILE_PINS */
+	(void)ConfigPtr;
+
+#elif (PORT_DEV_ERROR_DETECT == STD_ON)
+
+	if(NULL_PTR == ConfigPtr){
+
+		Error = TRUE;
+
+		Det_ReportError(PORT_MODULE_ID,
+				PORT_INSTANCE_ID,
+				PORT_INIT_SID,
+				PORT_E_PARAM_CONFIG);
+
+	}
+
+	else{
+
+		/* No Action Required */
+	}
+
+
+#endif
+
+#if ((PORT_CONFIG_VARIANT == PORT_VARIANT_POST_BUILD) && (PORT_CONFIG_IMAGE_SUPPORT == STD_ON))
+
+	/* Checked with or without Det: an image flashed on its own may be missing or corrupt */
+	if((FALSE == Error) && (FALSE == Port_IsConfigImageValid(ConfigPtr))){
+
+		Error = TRUE;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(PORT_MODULE_ID,
+				PORT_INSTANCE_ID,
+				PORT_INIT_SID,
+				PORT_E_PARAM_CONFIG);
+#endif
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+#endif
+
+	if(FALSE == Error){
+
+		Port_BuildDriverState(ConfigPtr);
+
+		Port_EnableClocks();
+
+#if (PORT_WARM_RESET_CHECK == STD_ON)
+		Port_CheckWarmReset();
+#endif
+
+		Port_ApplyPhase(TRUE);
+
+#if (PORT_DEFERRED_INIT == STD_ON)
+
+		Port_InitCursor = PORT_PORTA_ID;
+		Port_Status = PORT_INIT_PENDING;
+
+#else
+
+		Port_ApplyPhase(FALSE);
+
+#if (PORT_INIT_VERIFICATION == STD_ON)
+		Port_VerifyPorts();
+#endif
+
+		Port_Status = PORT_INITIALIZED;
+
+#endif
+	}
+
+
+	else{
+
+		/* No Action Required */
+
+	}
+}
+
+/************************************************************************************
+ * Service Name: Port_CompleteInit
+ * Service ID[hex]: 0x0C
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function that programs the pins left by Port_Init, the pins
+ *              without PORT_PIN_PRIORITY_CRITICAL.
+ ************************************************************************************/
+#if (PORT_DEFERRED_INIT == STD_ON)
+
+void Port_CompleteInit(void){
+
+	boolean Error = FALSE;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+
+	if(PORT_NOT_INITIALIZED == Port_Status){
+
+		Error = TRUE;
+
+		Det_ReportError(PORT_MODULE_ID,
+				PORT_INSTANCE_ID,
+				PORT_COMPLETE_INIT_SID,
+				PORT_E_UNINIT);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+#endif
+
+	if((FALSE == Error) && (PORT_INIT_PENDING == Port_Status)){
+
+		Port_ApplyDeferredPorts(PORT_NUMBER_OF_PORTS);
+	}
+
+	else{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+ * Service Name: Port_MainFunction
+ * Service ID[hex]: 0x0D
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Cyclic function that programs the pins left by Port_Init, at
+ *              most PORT_INIT_PORTS_PER_MAIN_FUNCTION ports per call.
+ ************************************************************************************/
+void Port_MainFunction(void){
+
+	/* Nothing to do before Port_Init or once the driver is initialized */
+	if(PORT_INIT_PENDING == Port_Status){
+
+		Port_ApplyDeferredPorts(PORT_INIT_PORTS_PER_MAIN_FUNCTION);
+	}
+
+	else{
+		/* No Action Required */
+	}
+}
+
+#endif
+
+/************************************************************************************
+ * Service Name: Port_GetStatus
+ * Service ID[hex]: 0x0E
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: PORT_NOT_INITIALIZED, PORT_INIT_PENDING or PORT_INITIALIZED
+ * Description: Function that returns the initialization status of the driver.
+ ************************************************************************************/
+uint8 Port_GetStatus(void){
+
+	return Port_Status;
+}
+
+/************************************************************************************
+ * Service Name: Port_GetVerificationResult
+ * Service ID[hex]: 0x0F
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Ports whose read back after Port_Init differed from the
+ *               configuration, bit n for port n, 0 when all the ports took it
+ * Description: Function that returns the result of the verification run at the
+ *              end of the initialization.
+ ************************************************************************************/
+#if (PORT_INIT_VERIFICATION == STD_ON)
+
+uint32 Port_GetVerificationResult(void){
+
+	return Port_VerificationFailures;
+}
+
+#endif
+
+/************************************************************************************
+ * Service Name: Port_SetPinDirection
+ * Service ID[hex]: 0x01
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Pin - Port Pin ID number
+ * 					Direction - Port Pin Direction
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function that Sets the port pin direction.
+ ************************************************************************************/
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+
+void Port_SetPinDirection(Port_PinType Pin,
+		Port_PinDirectionType Direction){
+
+	boolean Error = FALSE;
+
+#if (PORT_RUNTIME_CHECKS == STD_ON)
+
+	if(PORT_INITIALIZED != Port_Status){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_PIN_DIRECTION_SID, PORT_E_UNINIT);
+
+		PORT_LOG_EVENT(PORT_SET_PIN_DIRECTION_SID, PORT_E_UNINIT, Pin, PORT_EVENT_VALUE_UNKNOWN, Direction);
+	}
+
+	/* The descriptor is only valid for an initialized driver and an existing pin */
+	else if(Pin >= PORT_NUMBER_OF_PORT_PINS){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_PIN_DIRECTION_SID, PORT_E_PARAM_PIN);
+
+		PORT_LOG_EVENT(PORT_SET_PIN_DIRECTION_SID, PORT_E_PARAM_PIN, Pin, PORT_EVENT_VALUE_UNKNOWN, Direction);
+	}
+
+	else if(0U == (Port_PinDescriptors[Pin].Flags & PORT_PIN_FLAG_DIRECTION_CHANGEABLE)){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_PIN_DIRECTION_SID, PORT_E_DIRECTION_UNCHANGEABLE);
+
+		PORT_LOG_EVENT(PORT_SET_PIN_DIRECTION_SID, PORT_E_DIRECTION_UNCHANGEABLE, Pin, PORT_EVENT_VALUE_UNKNOWN, Direction);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+#endif
+
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+
+	/* Checked with or without Det, the ownership test indexes the configuration with it */
+	if((FALSE == Error) && (Pin >= PORT_NUMBER_OF_PORT_PINS)){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_PIN_DIRECTION_SID, PORT_E_PARAM_PIN);
+
+		PORT_LOG_EVENT(PORT_SET_PIN_DIRECTION_SID, PORT_E_PARAM_PIN, Pin, PORT_EVENT_VALUE_UNKNOWN, Direction);
+	}
+
+	else if((FALSE == Error) && (FALSE == Port_IsOwned(Port_PinDescriptors[Pin].Port, Port_PinDescriptors[Pin].PinBit))){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_PIN_DIRECTION_SID, PORT_E_PIN_NOT_OWNED);
+
+		PORT_LOG_EVENT(PORT_SET_PIN_DIRECTION_SID, PORT_E_PIN_NOT_OWNED, Pin, PORT_EVENT_VALUE_UNKNOWN, Direction);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+#endif
+
+	if(FALSE == Error){
+
+		const Port_PinDescriptorType * Descriptor = &Port_PinDescriptors[Pin];
+		uint32 Dir = PORT_REG_READ(GPIO_REG(Descriptor->Base, GPIO_DIR_REG_OFFSET));
+
+		PORT_REG_WRITE(GPIO_REG(Descriptor->Base, GPIO_DIR_REG_OFFSET),
+				(Dir & ~((uint32)Descriptor->PinBit)) | ((PORT_PIN_OUT == Direction) ? Descriptor->PinBit : 0U));
+
+		PORT_LOG_EVENT(PORT_SET_PIN_DIRECTION_SID, 0U, Pin,
+				(0U != (Dir & Descriptor->PinBit)) ? PORT_PIN_OUT : PORT_PIN_IN, Direction);
+
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+}
+
+#endif
+
+
+/************************************************************************************
+ * Service Name: Port_SetGroupDirection
+ * Service ID[hex]: 0x10
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant for the same port
+ * Parameters (in): Group - Pin group ID number
+ * 					Direction - Direction of all the pins of the group
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Sets the direction of all the pins of a group, e.g. the turnaround
+ *              of a parallel bus, with a single read-modify-write of GPIODIR.
+ ************************************************************************************/
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+
+void Port_SetGroupDirection(Port_GroupType Group,
+		Port_PinDirectionType Direction){
+
+	boolean Error = FALSE;
+
+#if (PORT_RUNTIME_CHECKS == STD_ON)
+
+	if(PORT_INITIALIZED != Port_Status){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_GROUP_DIRECTION_SID, PORT_E_UNINIT);
+
+	}
+
+	else if(Group >= PORT_NUMBER_OF_PIN_GROUPS){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_GROUP_DIRECTION_SID, PORT_E_PARAM_GROUP);
+	}
+
+	/* Group rejected by Port_Init */
+	else if(0U == Port_GroupDescriptors[Group].Pins){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_GROUP_DIRECTION_SID, PORT_E_DIRECTION_UNCHANGEABLE);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+#endif
+
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+
+	/* Checked with or without Det, the ownership test indexes the configuration with it */
+	if((FALSE == Error) && (Group >= PORT_NUMBER_OF_PIN_GROUPS)){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_GROUP_DIRECTION_SID, PORT_E_PARAM_GROUP);
+	}
+
+	else if((FALSE == Error) && (FALSE == Port_IsOwned(Port_GroupDescriptors[Group].Port, Port_GroupDescriptors[Group].Pins))){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_GROUP_DIRECTION_SID, PORT_E_PIN_NOT_OWNED);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+#endif
+
+	if(FALSE == Error){
+
+		const Port_GroupDescriptorType * Descriptor = &Port_GroupDescriptors[Group];
+
+		PORT_REG_MODIFY(GPIO_REG(Descriptor->Base, GPIO_DIR_REG_OFFSET),
+				Descriptor->Pins,
+				(PORT_PIN_OUT == Direction) ? Descriptor->Pins : 0U);
+
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+}
+
+#endif
+
+
+/************************************************************************************
+ * Service Name: Port_SetPinsDirection
+ * Service ID[hex]: 0x13
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant for the same port
+ * Parameters (in): Port - Port ID number
+ * 					Pins - Pins of the port to set, direction changeable and owned
+ * 					       by the partition of the caller
+ * 					Outputs - Pins set as outputs, the other Pins are set as inputs
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Sets the direction of a set of pins of one port with a single
+ *              read-modify-write of GPIODIR, so a partition reconfigures the
+ *              pins it owns in one call.
+ ************************************************************************************/
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+
+void Port_SetPinsDirection(Port_PortType Port, Port_PinMaskType Pins, Port_PinMaskType Outputs){
+
+	boolean Error = FALSE;
+
+#if (PORT_RUNTIME_CHECKS == STD_ON)
+
+	if(PORT_INITIALIZED != Port_Status){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_PINS_DIRECTION_SID, PORT_E_UNINIT);
+
+	}
+
+	else if(Port >= PORT_NUMBER_OF_PORTS){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_PINS_DIRECTION_SID, PORT_E_PARAM_PORT);
+	}
+
+	else if(0U != (Pins & ~(Port_PortImages[Port].PinMask & ~Port_PortImages[Port].RefreshMask))){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_PINS_DIRECTION_SID, PORT_E_DIRECTION_UNCHANGEABLE);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+#endif
+
+	/* Checked with or without Det, the ownership test indexes the configuration with it */
+	if((FALSE == Error) && (Port >= PORT_NUMBER_OF_PORTS)){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_PINS_DIRECTION_SID, PORT_E_PARAM_PORT);
+	}
+
+	else if((FALSE == Error) && (FALSE == Port_IsOwned(Port, Pins))){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_PINS_DIRECTION_SID, PORT_E_PIN_NOT_OWNED);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	if(FALSE == Error){
+
+		PORT_REG_MODIFY(GPIO_REG(Port_Device[Port].BaseAddress, GPIO_DIR_REG_OFFSET), Pins, Outputs);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+}
+
+#endif
+
+
+/************************************************************************************
+ * Service Name: Port_RefreshPortDirection
+ * Service ID[hex]: 0x02
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-Reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function that Refreshes port direction.
+ ************************************************************************************/
+void Port_RefreshPortDirection(void){
+
+	boolean Error = FALSE;
+
+#if (PORT_RUNTIME_CHECKS == STD_ON)
+
+	if(PORT_INITIALIZED != Port_Status){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_REFRESH_PORT_DIRECTION_SID, PORT_E_UNINIT);
+
+	}
+	else{
+		/* No Action Required */
+	}
+
+#endif
+
+	if(FALSE == Error){
+
+		for(uint8 Port = PORT_PORTA_ID ; Port < PORT_NUMBER_OF_PORTS ; Port++){
+
+			if(Port_PortImages[Port].RefreshMask != 0){
+
+				PORT_REG_MODIFY(GPIO_REG(Port_Device[Port].BaseAddress, GPIO_DIR_REG_OFFSET),
+						Port_PortImages[Port].RefreshMask,
+						Port_PortImages[Port].Dir);
+			}
+
+			else{
+				/* No Action Required */
+			}
+		}
+
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+
+}
+
+
+/************************************************************************************
+ * Service Name: Port_GetVersionInfo
+ * Service ID[hex]: 0x03
+ * Sync/Async: Synchronous
+ * Reentrancy: Non-Reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): versioninfo - Pointer to where to store the version information of this module.
+ * Return value: None
+ * Description: Returns the version information of this module.
+ ************************************************************************************/
+
+#if (PORT_VERSION_INFO_API == STD_ON)
+
+void Port_GetVersionInfo(Std_VersionInfoType* versioninfo){
+
+	boolean Error = FALSE;
+
+#if (PORT_RUNTIME_CHECKS == STD_ON)
+
+	if(PORT_INITIALIZED != Port_Status){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_GET_VERSION_INFO_SID, PORT_E_UNINIT);
+
+	}
+
+	else if(NULL_PTR == versioninfo){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_GET_VERSION_INFO_SID, PORT_E_PARAM_POINTER);
+
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+#endif
+
+	if(FALSE == Error){
+
+		/* Copy the vendor Id */
+		versioninfo->vendorID = (uint16)PORT_VENDOR_ID;
+		/* Copy the module Id */
+		versioninfo->moduleID = (uint16)PORT_MODULE_ID;
+		/* Copy Software Major Version */
+		versioninfo->sw_major_version = (uint8)PORT_SW_MAJOR_VERSION;
+		/* Copy Software Minor Version */
+		versioninfo->sw_minor_version = (uint8)PORT_SW_MINOR_VERSION;
+		/* Copy Software Patch Version */
+		versioninfo->sw_patch_version = (uint8)PORT_SW_PATCH_VERSION;
+
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+
+}
+#endif
+
+
+
+/************************************************************************************
+ * Service Name: Port_SetPinMode
+ * Service ID[hex]: 0x04
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Pin - Port Pin ID number
+ * 					Mode - New Port Pin mode to be set on port pin.
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Sets the port pin mode.
+ ************************************************************************************/
+
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+
+void Port_SetPinMode( Port_PinType Pin,
+		Port_PinModeType Mode ){
+
+	boolean Error = FALSE;
+
+#if (PORT_RUNTIME_CHECKS == STD_ON)
+
+	if(PORT_INITIALIZED != Port_Status){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_PIN_MODE_SID, PORT_E_UNINIT);
+
+		PORT_LOG_EVENT(PORT_SET_PIN_MODE_SID, PORT_E_UNINIT, Pin, PORT_EVENT_VALUE_UNKNOWN, Mode);
+	}
+
+	/* The descriptor is only valid for an initialized driver and an existing pin */
+	else if(Pin >= PORT_NUMBER_OF_PORT_PINS){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN);
+
+		PORT_LOG_EVENT(PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN, Pin, PORT_EVENT_VALUE_UNKNOWN, Mode);
+	}
+
+	else if(0U == (Port_PinDescriptors[Pin].Flags & PORT_PIN_FLAG_MODE_CHANGEABLE)){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_PIN_MODE_SID, PORT_E_MODE_UNCHANGEABLE);
+
+		PORT_LOG_EVENT(PORT_SET_PIN_MODE_SID, PORT_E_MODE_UNCHANGEABLE, Pin, PORT_EVENT_VALUE_UNKNOWN, Mode);
+	}
+
+	/* PORT_MODE_ADC is only valid on the analog capable pins of the device */
+	else if((Mode > PORT_MODE_ADC)
+			|| ((Mode == PORT_MODE_ADC) && (0U == (Port_PinDescriptors[Pin].Flags & PORT_PIN_FLAG_ANALOG)))){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_PIN_MODE_SID, PORT_E_PARAM_INVALID_MODE);
+
+		PORT_LOG_EVENT(PORT_SET_PIN_MODE_SID, PORT_E_PARAM_INVALID_MODE, Pin, PORT_EVENT_VALUE_UNKNOWN, Mode);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+
+#endif
+
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+
+	/* Checked with or without Det, the ownership test indexes the configuration with it */
+	if((FALSE == Error) && (Pin >= PORT_NUMBER_OF_PORT_PINS)){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN);
+
+		PORT_LOG_EVENT(PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN, Pin, PORT_EVENT_VALUE_UNKNOWN, Mode);
+	}
+
+	else if((FALSE == Error) && (FALSE == Port_IsOwned(Port_PinDescriptors[Pin].Port, Port_PinDescriptors[Pin].PinBit))){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_PIN_MODE_SID, PORT_E_PIN_NOT_OWNED);
+
+		PORT_LOG_EVENT(PORT_SET_PIN_MODE_SID, PORT_E_PIN_NOT_OWNED, Pin, PORT_EVENT_VALUE_UNKNOWN, Mode);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+#endif
+
+	if(FALSE == Error){
+
+		const Port_PinDescriptorType * Descriptor = &Port_PinDescriptors[Pin];
+		uint32 Base = Descriptor->Base;
+		uint32 PinBit = Descriptor->PinBit;
+		uint32 Amsel = PORT_REG_READ(GPIO_REG(Base, GPIO_AMSEL_REG_OFFSET));
+		uint32 Pctl;
+		uint32 Afsel;
+
+		/* AMSEL, PCTL and AFSEL are read once, their old values give the old mode to the event log */
+		if(Mode == PORT_MODE_ADC){
+
+			PORT_REG_WRITE(GPIO_REG(Base, GPIO_AMSEL_REG_OFFSET), Amsel | PinBit);
+			PORT_REG_MODIFY(GPIO_REG(Base, GPIO_DEN_REG_OFFSET), PinBit, 0U);
+		}
+
+		else{
+			PORT_REG_WRITE(GPIO_REG(Base, GPIO_AMSEL_REG_OFFSET), Amsel & ~PinBit);
+			PORT_REG_MODIFY(GPIO_REG(Base, GPIO_DEN_REG_OFFSET), PinBit, PinBit);
+		}
+
+		Pctl = PORT_REG_READ(GPIO_REG(Base, GPIO_PCTL_REG_OFFSET));
+		Afsel = PORT_REG_READ(GPIO_REG(Base, GPIO_AFSEL_REG_OFFSET));
+
+		switch(Mode){
+
+		case PORT_MODE_DIO:
+		case PORT_MODE_ADC:
+
+			PORT_REG_WRITE(GPIO_REG(Base, GPIO_PCTL_REG_OFFSET), Pctl & ~Descriptor->PctlMask);
+			PORT_REG_WRITE(GPIO_REG(Base, GPIO_AFSEL_REG_OFFSET), Afsel & ~PinBit);
+
+			break;
+
+		default:
+
+			PORT_REG_WRITE(GPIO_REG(Base, GPIO_PCTL_REG_OFFSET),
+					(Pctl & ~Descriptor->PctlMask) | (((uint32)Mode) << Descriptor->PctlShift));
+			PORT_REG_WRITE(GPIO_REG(Base, GPIO_AFSEL_REG_OFFSET), Afsel | PinBit);
+
+		}
+
+		PORT_LOG_EVENT(PORT_SET_PIN_MODE_SID, 0U, Pin, Port_ModeOf(Descriptor, Amsel, Afsel, Pctl), Mode);
+
+#if (PORT_MODE_PROFILE_API == STD_ON)
+		/* The pin may belong to the active profile, the next switch writes all its registers */
+		Port_ActiveProfile = PORT_PROFILE_NONE;
+#endif
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+}
+
+#endif
+
+
+/************************************************************************************
+ * Service Name: Port_SetModeProfile
+ * Service ID[hex]: 0x14
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): Profile - Mode profile ID number
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Puts all the pins of a mode profile in its mode, e.g. analog inputs
+ *              shared between sensing and driving. The register values are
+ *              precomputed by Port_Init: one read-modify-write per register and
+ *              port, and switching from the profile of the same pins only writes
+ *              the registers the two modes set differently.
+ ************************************************************************************/
+#if (PORT_MODE_PROFILE_API == STD_ON)
+
+void Port_SetModeProfile(Port_ProfileType Profile){
+
+	boolean Error = FALSE;
+
+#if (PORT_RUNTIME_CHECKS == STD_ON)
+
+	if(PORT_INITIALIZED != Port_Status){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_MODE_PROFILE_SID, PORT_E_UNINIT);
+
+	}
+
+	else if(Profile >= PORT_NUMBER_OF_MODE_PROFILES){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_MODE_PROFILE_SID, PORT_E_PARAM_PROFILE);
+	}
+
+	/* Profile rejected by Port_Init */
+	else if(0U == Port_ProfileDescriptors[Profile].Count){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_MODE_PROFILE_SID, PORT_E_MODE_UNCHANGEABLE);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+#endif
+
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+
+	/* Checked with or without Det, the ownership test indexes the profiles with it */
+	if((FALSE == Error) && (Profile >= PORT_NUMBER_OF_MODE_PROFILES)){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_MODE_PROFILE_SID, PORT_E_PARAM_PROFILE);
+	}
+
+	else if(FALSE == Error){
+
+		const Port_ProfileDescriptorType * Descriptor = &Port_ProfileDescriptors[Profile];
+
+		/* Stops at the first port not owned */
+		for(uint16 i = Descriptor->First ; (FALSE == Error) && (i < (Descriptor->First + Descriptor->Count)) ; i++){
+
+			if(FALSE == Port_IsOwned(Port_ProfilePorts[i].Port, Port_ProfilePorts[i].Pins)){
+
+				Error = TRUE;
+			}
+
+			else{
+				/* No Action Required */
+			}
+		}
+
+		if(TRUE == Error){
+
+			PORT_REPORT_ERROR(PORT_SET_MODE_PROFILE_SID, PORT_E_PIN_NOT_OWNED);
+		}
+
+		else{
+			/* No Action Required */
+		}
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+#endif
+
+	if(FALSE == Error){
+
+		const Port_ProfileDescriptorType * Descriptor = &Port_ProfileDescriptors[Profile];
+		uint8 Registers = (PORT_PROFILE_NONE == Port_ActiveProfile) ?
+				PORT_PROFILE_REG_ALL : Port_ProfileDeltas[Port_ActiveProfile][Profile];
+
+		/* Same order as Port_SetPinMode */
+		for(uint16 i = Descriptor->First ; i < (Descriptor->First + Descriptor->Count) ; i++){
+
+			const Port_ProfilePortType * Entry = &Port_ProfilePorts[i];
+
+			if(0U != (Registers & PORT_PROFILE_REG_AMSEL)){
+
+				PORT_REG_MODIFY(GPIO_REG(Entry->Base, GPIO_AMSEL_REG_OFFSET), Entry->Pins, Entry->Amsel);
+			}
+
+			else{
+				/* No Action Required */
+			}
+
+			if(0U != (Registers & PORT_PROFILE_REG_DEN)){
+
+				PORT_REG_MODIFY(GPIO_REG(Entry->Base, GPIO_DEN_REG_OFFSET), Entry->Pins, Entry->Den);
+			}
+
+			else{
+				/* No Action Required */
+			}
+
+			if(0U != (Registers & PORT_PROFILE_REG_PCTL)){
+
+				PORT_REG_MODIFY(GPIO_REG(Entry->Base, GPIO_PCTL_REG_OFFSET), Entry->PctlMask, Entry->Pctl);
+			}
+
+			else{
+				/* No Action Required */
+			}
+
+			if(0U != (Registers & PORT_PROFILE_REG_AFSEL)){
+
+				PORT_REG_MODIFY(GPIO_REG(Entry->Base, GPIO_AFSEL_REG_OFFSET), Entry->Pins, Entry->Afsel);
+			}
+
+			else{
+				/* No Action Required */
+			}
+		}
+
+		Port_ActiveProfile = Profile;
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+}
+
+#endif
+
 
 /************************************************************************************
- * Service Name: Port_Init
- * Service ID[hex]: 0x00
+ * Service Name: Port_EnablePinInterrupts
+ * Service ID[hex]: 0x05
  * Sync/Async: Synchronous
- * Reentrancy: Non reentrant
- * Parameters (in): ConfigPtr - Pointer to post-build configuration data
+ * Reentrancy: Reentrant
+ * Parameters (in): Port - Port ID number
+ * 					Pins - Pins of the port to arm, configured with an interrupt
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Function to Initialize the Port module.
+ * Description: Arms the interrupts of a set of pins with a single GPIOIM write,
+ *              serialized with the other arm and disarm calls by an exclusive area.
  ************************************************************************************/
-void Port_Init(const Port_ConfigType * ConfigPtr)
-{
 
-	boolean Error = FALSE ;
+#if (PORT_PIN_INTERRUPT_API == STD_ON)
 
-#if (PORT_DEV_ERROR_DETECT == STD_ON)
+void Port_EnablePinInterrupts(Port_PortType Port, Port_PinMaskType Pins){
 
-	if(NULL_PTR == ConfigPtr){
+	boolean Error = FALSE;
+
+#if (PORT_RUNTIME_CHECKS == STD_ON)
+
+	if(PORT_INITIALIZED != Port_Status){
 
 		Error = TRUE;
 
-		Det_ReportError(PORT_MODULE_ID,
-				PORT_INSTANCE_ID,
-				PORT_INIT_SID,
-				PORT_E_PARAM_CONFIG);
+		PORT_REPORT_ERROR(PORT_ENABLE_PIN_INTERRUPTS_SID, PORT_E_UNINIT);
+
+	}
+
+	else if(Port >= PORT_NUMBER_OF_PORTS){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_ENABLE_PIN_INTERRUPTS_SID, PORT_E_PARAM_PORT);
+	}
+
+	else if(0U != (Pins & ~Port_PortImages[Port].Im)){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_ENABLE_PIN_INTERRUPTS_SID, PORT_E_PARAM_PIN);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+#endif
+
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+
+	/* Checked with or without Det, the ownership test indexes the configuration with it */
+	if((FALSE == Error) && (Port >= PORT_NUMBER_OF_PORTS)){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_ENABLE_PIN_INTERRUPTS_SID, PORT_E_PARAM_PORT);
+	}
+
+	else if((FALSE == Error) && (FALSE == Port_IsOwned(Port, Pins))){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_ENABLE_PIN_INTERRUPTS_SID, PORT_E_PIN_NOT_OWNED);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+#endif
+
+	if(FALSE == Error){
+
+		/* The shadow and GPIOIM change together, a preempting call cannot slip in between */
+		PORT_ENTER_EXCLUSIVE_AREA();
+
+		Port_InterruptMasks[Port] |= Pins;
 
+		PORT_REG_WRITE(GPIO_REG(Port_Device[Port].BaseAddress, GPIO_IM_REG_OFFSET), Port_InterruptMasks[Port]);
+
+		PORT_EXIT_EXCLUSIVE_AREA();
 	}
 
 	else{
+		/* No Action Required */
+	}
+
+}
+
+/************************************************************************************
+ * Service Name: Port_DisablePinInterrupts
+ * Service ID[hex]: 0x06
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Port - Port ID number
+ * 					Pins - Pins of the port to disarm, configured with an interrupt
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Disarms the interrupts of a set of pins with a single GPIOIM write,
+ *              serialized with the other arm and disarm calls by an exclusive area.
+ ************************************************************************************/
+void Port_DisablePinInterrupts(Port_PortType Port, Port_PinMaskType Pins){
+
+	boolean Error = FALSE;
+
+#if (PORT_RUNTIME_CHECKS == STD_ON)
+
+	if(PORT_INITIALIZED != Port_Status){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_DISABLE_PIN_INTERRUPTS_SID, PORT_E_UNINIT);
+
+	}
+
+	else if(Port >= PORT_NUMBER_OF_PORTS){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_DISABLE_PIN_INTERRUPTS_SID, PORT_E_PARAM_PORT);
+	}
+
+	else if(0U != (Pins & ~Port_PortImages[Port].Im)){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_DISABLE_PIN_INTERRUPTS_SID, PORT_E_PARAM_PIN);
+	}
 
+	else{
 		/* No Action Required */
 	}
 
+#endif
+
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+
+	/* Checked with or without Det, the ownership test indexes the configuration with it */
+	if((FALSE == Error) && (Port >= PORT_NUMBER_OF_PORTS)){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_DISABLE_PIN_INTERRUPTS_SID, PORT_E_PARAM_PORT);
+	}
+
+	else if((FALSE == Error) && (FALSE == Port_IsOwned(Port, Pins))){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_DISABLE_PIN_INTERRUPTS_SID, PORT_E_PIN_NOT_OWNED);
+	}
+
+	else{
+		/* No Action Required */
+	}
 
 #endif
 
 	if(FALSE == Error){
 
-		for(Port_PinType i = PORT_PIN0_ID ; i < PORT_NUMBER_OF_PORT_PINS ; i++){
+		/* The shadow and GPIOIM change together, a preempting call cannot slip in between */
+		PORT_ENTER_EXCLUSIVE_AREA();
 
-			/*Step 1 : Configure the CLock*/
-			if(ClockConfigured[Port_Pins[i].Port_Num] == FALSE){
+		Port_InterruptMasks[Port] &= ~((uint32)Pins);
 
-				SET_BIT(SYSCTL_REGCGC2_REG, Port_Pins[i].Port_Num);
+		PORT_REG_WRITE(GPIO_REG(Port_Device[Port].BaseAddress, GPIO_IM_REG_OFFSET), Port_InterruptMasks[Port]);
 
-				ClockConfigured[Port_Pins[i].Port_Num] = TRUE;
-			}
+		PORT_EXIT_EXCLUSIVE_AREA();
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+}
 
+#endif
 
-			/*Step 2 : Unlock a pin if required*/
 
-			switch(Port_Pins[i].Port_Num){
+/************************************************************************************
+ * Service Name: Port_SetPinTrigger
+ * Service ID[hex]: 0x07
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Pin - Port Pin ID number
+ * 					Trigger - ADC and/or uDMA trigger raised by the pin
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Routes the pin to the ADC and uDMA trigger inputs.
+ ************************************************************************************/
 
-			case PORT_PORTC_ID:
-				break;
+#if (PORT_SET_PIN_TRIGGER_API == STD_ON)
 
-			case PORT_PORTD_ID:
-				if(Port_Pins[i].Pin_Num == PORT_PIN7_ID){ /*PD7*/
+void Port_SetPinTrigger(Port_PinType Pin,
+		Port_PinTriggerType Trigger){
 
-					GPIO_PORTD_LOCK_REG = UNLOCKING_VALUE;
+	boolean Error = FALSE;
 
-					SET_BIT(GPIO_PORTD_CR_REG,Port_Pins[i].Pin_Num);
+#if (PORT_RUNTIME_CHECKS == STD_ON)
 
-				}
-				break;
+	if(PORT_INITIALIZED != Port_Status){
 
-			case PORT_PORTF_ID: 
-				if(Port_Pins[i].Pin_Num == PORT_PIN0_ID){ /*PF0*/
+		Error = TRUE;
 
-					GPIO_PORTF_LOCK_REG = UNLOCKING_VALUE;
+		PORT_REPORT_ERROR(PORT_SET_PIN_TRIGGER_SID, PORT_E_UNINIT);
 
-					SET_BIT(GPIO_PORTF_CR_REG,Port_Pins[i].Pin_Num);
+	}
 
-				}
-				break;
+	else if(Pin >= PORT_NUMBER_OF_PORT_PINS){
 
-			}
+		Error = TRUE;
 
-			/*Step 3 : Set digital or analog*/
-			{
-				volatile uint32 * DEN_Registers[] = {&GPIO_PORTA_DEN_REG ,
-						&GPIO_PORTB_DEN_REG ,
-						&GPIO_PORTC_DEN_REG,
-						&GPIO_PORTD_DEN_REG,
-						&GPIO_PORTE_DEN_REG,
-						&GPIO_PORTF_DEN_REG};
+		PORT_REPORT_ERROR(PORT_SET_PIN_TRIGGER_SID, PORT_E_PARAM_PIN);
+	}
 
+	else if(0U == (Port_PinDescriptors[Pin].Flags & PORT_PIN_FLAG_MODE_CHANGEABLE)){
 
-				volatile uint32 * AMSEL_Registers[] = {&GPIO_PORTA_AMSEL_REG ,
-						&GPIO_PORTB_AMSEL_REG ,
-						&GPIO_PORTC_AMSEL_REG,
-						&GPIO_PORTD_AMSEL_REG,
-						&GPIO_PORTE_AMSEL_REG,
-						&GPIO_PORTF_AMSEL_REG};
+		Error = TRUE;
 
-				if(Port_Pins[i].pin_mode == PORT_MODE_ADC){
+		PORT_REPORT_ERROR(PORT_SET_PIN_TRIGGER_SID, PORT_E_MODE_UNCHANGEABLE);
+	}
 
-					SET_BIT(*AMSEL_Registers[Port_Pins[i].Port_Num] , Port_Pins[i].Pin_Num);
-					CLEAR_BIT(*DEN_Registers[Port_Pins[i].Port_Num] , Port_Pins[i].Pin_Num);
-				}
+	else if(Trigger > PORT_PIN_TRIGGER_ADC_AND_DMA){
 
-				else{
-					CLEAR_BIT(*AMSEL_Registers[Port_Pins[i].Port_Num] , Port_Pins[i].Pin_Num);
-					SET_BIT(*DEN_Registers[Port_Pins[i].Port_Num] , Port_Pins[i].Pin_Num);
-				}
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_PIN_TRIGGER_SID, PORT_E_PARAM_INVALID_MODE);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+#endif
+
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+
+	/* Checked with or without Det, the ownership test indexes the configuration with it */
+	if((FALSE == Error) && (Pin >= PORT_NUMBER_OF_PORT_PINS)){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_PIN_TRIGGER_SID, PORT_E_PARAM_PIN);
+	}
+
+	else if((FALSE == Error) && (FALSE == Port_IsOwned(Port_PinDescriptors[Pin].Port, Port_PinDescriptors[Pin].PinBit))){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SET_PIN_TRIGGER_SID, PORT_E_PIN_NOT_OWNED);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+#endif
 
-			}
+	if(FALSE == Error){
 
+		uint32 Base = Port_PinDescriptors[Pin].Base;
+		uint32 PinBit = Port_PinDescriptors[Pin].PinBit;
 
-			/*Step 4 : Set the Alternate function*/
-			{
-				volatile uint32 * AFSEL_Registers[] = {&GPIO_PORTA_AFSEL_REG ,
-						&GPIO_PORTB_AFSEL_REG ,
-						&GPIO_PORTC_AFSEL_REG,
-						&GPIO_PORTD_AFSEL_REG,
-						&GPIO_PORTE_AFSEL_REG,
-						&GPIO_PORTF_AFSEL_REG};
+		PORT_REG_MODIFY(GPIO_REG(Base, GPIO_ADCCTL_REG_OFFSET),
+				PinBit,
+				((Trigger == PORT_PIN_TRIGGER_ADC) || (Trigger == PORT_PIN_TRIGGER_ADC_AND_DMA)) ? PinBit : 0U);
 
-				volatile uint32 * PCTL_Registers[] = {&GPIO_PORTA_PCTL_REG ,
-						&GPIO_PORTB_PCTL_REG ,
-						&GPIO_PORTC_PCTL_REG,
-						&GPIO_PORTD_PCTL_REG,
-						&GPIO_PORTE_PCTL_REG,
-						&GPIO_PORTF_PCTL_REG};
+		PORT_REG_MODIFY(GPIO_REG(Base, GPIO_DMACTL_REG_OFFSET),
+				PinBit,
+				((Trigger == PORT_PIN_TRIGGER_DMA) || (Trigger == PORT_PIN_TRIGGER_ADC_AND_DMA)) ? PinBit : 0U);
+	}
 
-				*PCTL_Registers[Port_Pins[i].Port_Num] &= ~( ((uint32)0x0F) <<(4* Port_Pins[i].Pin_Num)) ;
+	else{
+		/* No Action Required */
+	}
 
-				switch(Port_Pins[i].pin_mode){
+}
 
-				case PORT_MODE_DIO:
-				case PORT_MODE_ADC:
+#endif
 
-					CLEAR_BIT(*AFSEL_Registers[Port_Pins[i].Port_Num] , Port_Pins[i].Pin_Num);
 
-					break;
+/************************************************************************************
+ * Service Name: Port_GetPinHandle
+ * Service ID[hex]: 0x08
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Pin - Port Pin ID number, owned by the partition of the caller
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Port_PinHandleType - Handle of the pin, PORT_INVALID_PIN_HANDLE on error
+ * Description: Returns the masked GPIODATA address of a pin, to be used with
+ *              PORT_READ_HANDLE / PORT_WRITE_HANDLE.
+ ************************************************************************************/
 
-				default:
+#if (PORT_PIN_HANDLE_API == STD_ON)
 
-					SET_BIT(*AFSEL_Registers[Port_Pins[i].Port_Num] , Port_Pins[i].Pin_Num);
+Port_PinHandleType Port_GetPinHandle(Port_PinType Pin){
 
-					*PCTL_Registers[Port_Pins[i].Port_Num] |= ( ( (uint32)Port_Pins[i].pin_mode)<<(4*Port_Pins[i].Pin_Num) );
+	boolean Error = FALSE;
+	Port_PinHandleType Handle = PORT_INVALID_PIN_HANDLE;
 
+#if (PORT_RUNTIME_CHECKS == STD_ON)
 
-				}
+	if(PORT_INITIALIZED != Port_Status){
 
-			}
+		Error = TRUE;
 
-			/*Step 5 : Set the Direction of the pin*/
-			{
-				volatile uint32 * Direction_Registers[] = {&GPIO_PORTA_DIR_REG ,
-						&GPIO_PORTB_DIR_REG ,
-						&GPIO_PORTC_DIR_REG,
-						&GPIO_PORTD_DIR_REG,
-						&GPIO_PORTE_DIR_REG,
-						&GPIO_PORTF_DIR_REG};
+		PORT_REPORT_ERROR(PORT_GET_PIN_HANDLE_SID, PORT_E_UNINIT);
 
-				WRITE_BIT(*Direction_Registers[Port_Pins[i].Port_Num] ,  Port_Pins[i].Pin_Num , Port_Pins[i].direction);
-			}
+	}
 
-			/*Step 6 : Set the initial value*/
+	else if(Pin >= PORT_NUMBER_OF_PORT_PINS){
 
-			if(Port_Pins[i].direction == PORT_PIN_OUT){
+		Error = TRUE;
 
-				volatile uint32 * DATA_Registers[] = {&GPIO_PORTA_DATA_REG ,
-						&GPIO_PORTB_DATA_REG ,
-						&GPIO_PORTC_DATA_REG,
-						&GPIO_PORTD_DATA_REG,
-						&GPIO_PORTE_DATA_REG,
-						&GPIO_PORTF_DATA_REG};
+		PORT_REPORT_ERROR(PORT_GET_PIN_HANDLE_SID, PORT_E_PARAM_PIN);
+	}
 
-				WRITE_BIT(*DATA_Registers[Port_Pins[i].Port_Num] ,  Port_Pins[i].Pin_Num , Port_Pins[i].initial_value);
+	else{
+		/* No Action Required */
+	}
 
-			}
+#endif
 
-			/*Step 7 : Configure Internal Resistances*/
+#if (PORT_PIN_OWNERSHIP == STD_ON)
 
-			else if((Port_Pins[i].direction == PORT_PIN_IN) && (Port_Pins[i].resistance != PORT_RESISTANCE_OFF) ){
+	/* A handle writes the pin without any later check, so only its owner gets one */
+	if((FALSE == Error) && (Pin >= PORT_NUMBER_OF_PORT_PINS)){
 
-				volatile uint32 *Resistance_Registers[][PORT_NUMBER_OF_PORTS] ={
-						{&GPIO_PORTA_PUR_REG ,
-								&GPIO_PORTB_PUR_REG ,
-								&GPIO_PORTC_PUR_REG,
-								&GPIO_PORTD_PUR_REG,
-								&GPIO_PORTE_PUR_REG,
-								&GPIO_PORTF_PUR_REG},
+		Error = TRUE;
 
-								&GPIO_PORTA_PDR_REG ,
-										&GPIO_PORTB_PDR_REG ,
-										&GPIO_PORTC_PDR_REG,
-										&GPIO_PORTD_PDR_REG,
-										&GPIO_PORTE_PDR_REG,
-										&GPIO_PORTF_PDR_REG
-				};
+		PORT_REPORT_ERROR(PORT_GET_PIN_HANDLE_SID, PORT_E_PARAM_PIN);
+	}
 
-				SET_BIT(*Resistance_Registers[Port_Pins[i].resistance][Port_Pins[i].Port_Num] , Port_Pins[i].Pin_Num);
-			}
+	else if((FALSE == Error) && (FALSE == Port_IsOwned(Port_PinDescriptors[Pin].Port, Port_PinDescriptors[Pin].PinBit))){
 
+		Error = TRUE;
 
+		PORT_REPORT_ERROR(PORT_GET_PIN_HANDLE_SID, PORT_E_PIN_NOT_OWNED);
+	}
 
-		}
+	else{
+		/* No Action Required */
+	}
 
+#endif
 
+	if(FALSE == Error){
 
-		Port_Status = PORT_INITIALIZED;
+		Handle = GPIO_REG(Port_PinDescriptors[Pin].Base, GPIO_DATA_MASKED_OFFSET(Port_PinDescriptors[Pin].PinBit));
 	}
 
-
 	else{
-
 		/* No Action Required */
-
 	}
+
+	return Handle;
 }
 
 /************************************************************************************
- * Service Name: Port_SetPinDirection
- * Service ID[hex]: 0x01
+ * Service Name: Port_GetGroupHandle
+ * Service ID[hex]: 0x09
  * Sync/Async: Synchronous
  * Reentrancy: Reentrant
- * Parameters (in): Pin - Port Pin ID number
- * 					Direction - Port Pin Direction
+ * Parameters (in): Port - Port ID number
+ * 					Pins - Pins of the port reached through the handle, owned by
+ * 					       the partition of the caller
  * Parameters (inout): None
  * Parameters (out): None
- * Return value: None
- * Description: Function that Sets the port pin direction.
+ * Return value: Port_PinHandleType - Handle of the pins, PORT_INVALID_PIN_HANDLE on error
+ * Description: Returns the masked GPIODATA address of a set of pins of one port,
+ *              to be used with PORT_READ_HANDLE / PORT_WRITE_HANDLE.
  ************************************************************************************/
-#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
-
-void Port_SetPinDirection(Port_PinType Pin,
-		Port_PinDirectionType Direction){
+Port_PinHandleType Port_GetGroupHandle(Port_PortType Port, Port_PinMaskType Pins){
 
 	boolean Error = FALSE;
+	Port_PinHandleType Handle = PORT_INVALID_PIN_HANDLE;
 
-#if (PORT_DEV_ERROR_DETECT == STD_ON)
+#if (PORT_RUNTIME_CHECKS == STD_ON)
 
-	if(PORT_NOT_INITIALIZED == Port_Status){
+	if(PORT_INITIALIZED != Port_Status){
 
 		Error = TRUE;
 
-		Det_ReportError(PORT_MODULE_ID,
-				PORT_INSTANCE_ID,
-				PORT_SET_PIN_DIRECTION_SID,
-				PORT_E_UNINIT);
+		PORT_REPORT_ERROR(PORT_GET_GROUP_HANDLE_SID, PORT_E_UNINIT);
 
 	}
-	else{
-		/* No Action Required */
-	}
 
+	else if(Port >= PORT_NUMBER_OF_PORTS){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_GET_GROUP_HANDLE_SID, PORT_E_PARAM_PORT);
+	}
 
-	if( (Pin >= PORT_NUMBER_OF_PORT_PINS) || (Pin < 0) ){
+	else if((0U == Pins) || (0U != (Pins & ~Port_PortImages[Port].PinMask))){
 
 		Error = TRUE;
 
-		Det_ReportError(PORT_MODULE_ID,
-				PORT_INSTANCE_ID,
-				PORT_SET_PIN_DIRECTION_SID,
-				PORT_E_PARAM_PIN);
+		PORT_REPORT_ERROR(PORT_GET_GROUP_HANDLE_SID, PORT_E_PARAM_PIN);
 	}
 
 	else{
 		/* No Action Required */
 	}
 
+#endif
+
+#if (PORT_PIN_OWNERSHIP == STD_ON)
 
-	if(PORT_PIN_DIRECTION_NON_CHANGEABLE == Port_Pins[Pin].changeableDirection){
+	/* A handle writes the pins without any later check, so only their owner gets one */
+	if((FALSE == Error) && (Port >= PORT_NUMBER_OF_PORTS)){
 
 		Error = TRUE;
 
-		Det_ReportError(PORT_MODULE_ID,
-				PORT_INSTANCE_ID,
-				PORT_SET_PIN_DIRECTION_SID,
-				PORT_E_DIRECTION_UNCHANGEABLE);
+		PORT_REPORT_ERROR(PORT_GET_GROUP_HANDLE_SID, PORT_E_PARAM_PORT);
+	}
+
+	else if((FALSE == Error) && (FALSE == Port_IsOwned(Port, Pins))){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_GET_GROUP_HANDLE_SID, PORT_E_PIN_NOT_OWNED);
 	}
 
 	else{
@@ -312,55 +3067,56 @@ void Port_SetPinDirection(Port_PinType Pin,
 
 	if(FALSE == Error){
 
-
-		volatile uint32 * Direction_Registers[] = {&GPIO_PORTA_DIR_REG ,
-				&GPIO_PORTB_DIR_REG ,
-				&GPIO_PORTC_DIR_REG,
-				&GPIO_PORTD_DIR_REG,
-				&GPIO_PORTE_DIR_REG,
-				&GPIO_PORTF_DIR_REG};
-
-		WRITE_BIT(*Direction_Registers[Port_Pins[Pin].Port_Num] ,  Port_Pins[Pin].Pin_Num , Direction);
-
-
+		Handle = GPIO_REG(Port_Device[Port].BaseAddress, GPIO_DATA_MASKED_OFFSET(Pins));
 	}
 
 	else{
 		/* No Action Required */
 	}
 
+	return Handle;
 }
 
 #endif
 
 
 /************************************************************************************
- * Service Name: Port_RefreshPortDirection
- * Service ID[hex]: 0x02
+ * Service Name: Port_SaveContext
+ * Service ID[hex]: 0x0A
  * Sync/Async: Synchronous
  * Reentrancy: Non-Reentrant
  * Parameters (in): None
  * Parameters (inout): None
- * Parameters (out): None
+ * Parameters (out): Context - Pointer to where to store the context of the configured ports
  * Return value: None
- * Description: Function that Refreshes port direction.
+ * Description: Saves the GPIO registers of every configured port, including the
+ *              changes made at runtime, before hibernation.
  ************************************************************************************/
-void Port_RefreshPortDirection(void){
+
+#if (PORT_CONTEXT_API == STD_ON)
+
+void Port_SaveContext(Port_ContextType * Context){
 
 	boolean Error = FALSE;
 
-#if (PORT_DEV_ERROR_DETECT == STD_ON)
+#if (PORT_RUNTIME_CHECKS == STD_ON)
 
-	if(PORT_NOT_INITIALIZED == Port_Status){
+	if(PORT_INITIALIZED != Port_Status){
 
 		Error = TRUE;
 
-		Det_ReportError(PORT_MODULE_ID,
-				PORT_INSTANCE_ID,
-				PORT_REFRESH_PORT_DIRECTION_SID,
-				PORT_E_UNINIT);
+		PORT_REPORT_ERROR(PORT_SAVE_CONTEXT_SID, PORT_E_UNINIT);
+
+	}
+
+	else if(NULL_PTR == Context){
+
+		Error = TRUE;
+
+		PORT_REPORT_ERROR(PORT_SAVE_CONTEXT_SID, PORT_E_PARAM_POINTER);
 
 	}
+
 	else{
 		/* No Action Required */
 	}
@@ -369,19 +3125,44 @@ void Port_RefreshPortDirection(void){
 
 	if(FALSE == Error){
 
-		volatile uint32 * Direction_Registers[] = {&GPIO_PORTA_DIR_REG ,
-				&GPIO_PORTB_DIR_REG ,
-				&GPIO_PORTC_DIR_REG,
-				&GPIO_PORTD_DIR_REG,
-				&GPIO_PORTE_DIR_REG,
-				&GPIO_PORTF_DIR_REG};
-
-		for(Port_PinType i = PORT_PIN0_ID ; i < PORT_NUMBER_OF_PORT_PINS ; i++){
-
-			if(PORT_PIN_DIRECTION_NON_CHANGEABLE == Port_Pins[i].changeableDirection){
-
-				WRITE_BIT(*Direction_Registers[Port_Pins[i].Port_Num] ,  Port_Pins[i].Pin_Num , Port_Pins[i].direction);
+		Context->Magic = PORT_CONTEXT_MAGIC;
+		Context->FormatVersion = PORT_CONTEXT_FORMAT_VERSION;
 
+#if (PORT_CONFIG_VARIANT == PORT_VARIANT_PRE_COMPILE)
+		Context->ConfigPtr = NULL_PTR;
+#else
+		Context->ConfigPtr = Port_ConfigPtr;
+#endif
+		Context->SavedPorts = 0;
+
+		for(uint8 Port = PORT_PORTA_ID ; Port < PORT_NUMBER_OF_PORTS ; Port++){
+
+			Port_PortContextType * Saved = &Context->Ports[Port];
+			uint32 Base = Port_Device[Port].BaseAddress;
+
+			if(Port_PortImages[Port].PinMask != 0){
+
+				Saved->Data = PORT_REG_READ(GPIO_REG(Base, GPIO_DATA_REG_OFFSET));
+				Saved->Dir = PORT_REG_READ(GPIO_REG(Base, GPIO_DIR_REG_OFFSET));
+				Saved->Is = PORT_REG_READ(GPIO_REG(Base, GPIO_IS_REG_OFFSET));
+				Saved->Ibe = PORT_REG_READ(GPIO_REG(Base, GPIO_IBE_REG_OFFSET));
+				Saved->Iev = PORT_REG_READ(GPIO_REG(Base, GPIO_IEV_REG_OFFSET));
+				Saved->Im = Port_InterruptMasks[Port];
+				Saved->Afsel = PORT_REG_READ(GPIO_REG(Base, GPIO_AFSEL_REG_OFFSET));
+				Saved->Dr2r = PORT_REG_READ(GPIO_REG(Base, GPIO_DR2R_REG_OFFSET));
+				Saved->Dr4r = PORT_REG_READ(GPIO_REG(Base, GPIO_DR4R_REG_OFFSET));
+				Saved->Dr8r = PORT_REG_READ(GPIO_REG(Base, GPIO_DR8R_REG_OFFSET));
+				Saved->Odr = PORT_REG_READ(GPIO_REG(Base, GPIO_ODR_REG_OFFSET));
+				Saved->Pur = PORT_REG_READ(GPIO_REG(Base, GPIO_PUR_REG_OFFSET));
+				Saved->Pdr = PORT_REG_READ(GPIO_REG(Base, GPIO_PDR_REG_OFFSET));
+				Saved->Slr = PORT_REG_READ(GPIO_REG(Base, GPIO_SLR_REG_OFFSET));
+				Saved->Den = PORT_REG_READ(GPIO_REG(Base, GPIO_DEN_REG_OFFSET));
+				Saved->Amsel = PORT_REG_READ(GPIO_REG(Base, GPIO_AMSEL_REG_OFFSET));
+				Saved->Pctl = PORT_REG_READ(GPIO_REG(Base, GPIO_PCTL_REG_OFFSET));
+				Saved->Adcctl = PORT_REG_READ(GPIO_REG(Base, GPIO_ADCCTL_REG_OFFSET));
+				Saved->Dmactl = PORT_REG_READ(GPIO_REG(Base, GPIO_DMACTL_REG_OFFSET));
+
+				Context->SavedPorts |= ((uint32)1) << Port;
 			}
 
 			else{
@@ -389,254 +3170,318 @@ void Port_RefreshPortDirection(void){
 			}
 		}
 
+		Context->Crc = Port_Crc32((const uint8 *)Context, offsetof(Port_ContextType, Crc));
 	}
 
 	else{
 		/* No Action Required */
 	}
 
-
 }
 
-
 /************************************************************************************
- * Service Name: Port_GetVersionInfo
- * Service ID[hex]: 0x03
+ * Service Name: Port_RestoreContext
+ * Service ID[hex]: 0x0B
  * Sync/Async: Synchronous
  * Reentrancy: Non-Reentrant
- * Parameters (in): None
+ * Parameters (in): Context - Context saved by Port_SaveContext
  * Parameters (inout): None
- * Parameters (out): versioninfo - Pointer to where to store the version information of this module.
+ * Parameters (out): None
  * Return value: None
- * Description: Returns the version information of this module.
+ * Description: Restores the saved ports after hibernation in place of Port_Init,
+ *              with one write per register and one unlock sequence per port.
+ *              A context that fails its checks, or whose ports do not read back
+ *              with PORT_INIT_VERIFICATION, leaves the driver uninitialized.
  ************************************************************************************/
-
-#if (PORT_VERSION_INFO_API == STD_ON)
-
-void Port_GetVersionInfo(Std_VersionInfoType* versioninfo){
+void Port_RestoreContext(const Port_ContextType * Context){
 
 	boolean Error = FALSE;
 
-#if (PORT_DEV_ERROR_DETECT == STD_ON)
+#if (PORT_RUNTIME_CHECKS == STD_ON)
 
-	if(PORT_NOT_INITIALIZED == Port_Status){
+	if(NULL_PTR == Context){
 
 		Error = TRUE;
 
-		Det_ReportError(PORT_MODULE_ID,
-				PORT_INSTANCE_ID,
-				PORT_GET_VERSION_INFO_SID,
-				PORT_E_UNINIT);
+		PORT_REPORT_ERROR(PORT_RESTORE_CONTEXT_SID, PORT_E_PARAM_POINTER);
 
 	}
+
 	else{
 		/* No Action Required */
 	}
 
+#endif
 
-
-
-	if(NULL_PTR == versioninfo){
+	/* Checked with or without Det: the registers and the driver state are rebuilt from it */
+	if((FALSE == Error) && (FALSE == Port_IsContextValid(Context))){
 
 		Error = TRUE;
 
-		Det_ReportError(PORT_MODULE_ID,
-				PORT_INSTANCE_ID,
-				PORT_GET_VERSION_INFO_SID,
-				PORT_E_PARAM_POINTER);
-
+		PORT_REPORT_ERROR(PORT_RESTORE_CONTEXT_SID, PORT_E_PARAM_CONFIG);
 	}
 
 	else{
 		/* No Action Required */
 	}
 
+	if(FALSE == Error){
+
+		/* The driver state is rebuilt in RAM only, the registers come from the context */
+		Port_BuildDriverState(Context->ConfigPtr);
+
+		Port_EnableClocks();
+
+#if (PORT_DEFERRED_INIT == STD_ON)
+		/* Every port is restored here, none is left to Port_MainFunction */
+		Port_InitCursor = PORT_NUMBER_OF_PORTS;
 #endif
 
-	if(FALSE == Error){
+#if (PORT_INIT_VERIFICATION == STD_ON)
+		Port_VerificationFailures = 0U;
+#endif
 
-		/* Copy the vendor Id */
-		versioninfo->vendorID = (uint16)PORT_VENDOR_ID;
-		/* Copy the module Id */
-		versioninfo->moduleID = (uint16)PORT_MODULE_ID;
-		/* Copy Software Major Version */
-		versioninfo->sw_major_version = (uint8)PORT_SW_MAJOR_VERSION;
-		/* Copy Software Minor Version */
-		versioninfo->sw_minor_version = (uint8)PORT_SW_MINOR_VERSION;
-		/* Copy Software Patch Version */
-		versioninfo->sw_patch_version = (uint8)PORT_SW_PATCH_VERSION;
+		for(uint8 Port = PORT_PORTA_ID ; Port < PORT_NUMBER_OF_PORTS ; Port++){
+
+			const Port_PortContextType * Saved = &Context->Ports[Port];
+			uint32 Base = Port_Device[Port].BaseAddress;
+			uint32 UnlockMask = Port_PortImages[Port].PinMask & Port_Device[Port].LockedPins;
+
+			if(0U != (Context->SavedPorts & (((uint32)1) << Port))){
+
+				/* Commit the locked pins, the other pins keep their reset commit state */
+				if(UnlockMask != 0){
+
+					PORT_REG_WRITE(GPIO_REG(Base, GPIO_LOCK_REG_OFFSET), UNLOCKING_VALUE);
+					PORT_REG_WRITE(GPIO_REG(Base, GPIO_CR_REG_OFFSET),
+							(((uint32)0xFF) & ~((uint32)Port_Device[Port].LockedPins | Port_Device[Port].ReservedPins)) | UnlockMask);
+				}
+
+				else{
+					/* No Action Required */
+				}
+
+				/* Output levels are latched before the pins become outputs */
+				PORT_REG_WRITE(GPIO_REG(Base, GPIO_DATA_REG_OFFSET), Saved->Data);
+				PORT_REG_WRITE(GPIO_REG(Base, GPIO_PCTL_REG_OFFSET), Saved->Pctl);
+				PORT_REG_WRITE(GPIO_REG(Base, GPIO_AFSEL_REG_OFFSET), Saved->Afsel);
+				PORT_REG_WRITE(GPIO_REG(Base, GPIO_DR2R_REG_OFFSET), Saved->Dr2r);
+				PORT_REG_WRITE(GPIO_REG(Base, GPIO_DR4R_REG_OFFSET), Saved->Dr4r);
+				PORT_REG_WRITE(GPIO_REG(Base, GPIO_DR8R_REG_OFFSET), Saved->Dr8r);
+				PORT_REG_WRITE(GPIO_REG(Base, GPIO_SLR_REG_OFFSET), Saved->Slr);
+				PORT_REG_WRITE(GPIO_REG(Base, GPIO_ODR_REG_OFFSET), Saved->Odr);
+				PORT_REG_WRITE(GPIO_REG(Base, GPIO_PUR_REG_OFFSET), Saved->Pur);
+				PORT_REG_WRITE(GPIO_REG(Base, GPIO_PDR_REG_OFFSET), Saved->Pdr);
+				PORT_REG_WRITE(GPIO_REG(Base, GPIO_AMSEL_REG_OFFSET), Saved->Amsel);
+				PORT_REG_WRITE(GPIO_REG(Base, GPIO_DEN_REG_OFFSET), Saved->Den);
+				PORT_REG_WRITE(GPIO_REG(Base, GPIO_DIR_REG_OFFSET), Saved->Dir);
+
+				/* Interrupts are armed last, once their sense is restored */
+				PORT_REG_WRITE(GPIO_REG(Base, GPIO_IS_REG_OFFSET), Saved->Is);
+				PORT_REG_WRITE(GPIO_REG(Base, GPIO_IBE_REG_OFFSET), Saved->Ibe);
+				PORT_REG_WRITE(GPIO_REG(Base, GPIO_IEV_REG_OFFSET), Saved->Iev);
+				PORT_REG_WRITE(GPIO_REG(Base, GPIO_ICR_REG_OFFSET), Saved->Im);
+				PORT_REG_WRITE(GPIO_REG(Base, GPIO_IM_REG_OFFSET), Saved->Im);
+				PORT_REG_WRITE(GPIO_REG(Base, GPIO_ADCCTL_REG_OFFSET), Saved->Adcctl);
+				PORT_REG_WRITE(GPIO_REG(Base, GPIO_DMACTL_REG_OFFSET), Saved->Dmactl);
+
+				Port_InterruptMasks[Port] = Saved->Im;
+
+#if (PORT_INIT_VERIFICATION == STD_ON)
+				if(0U != Port_ReadBackContext(Port, Saved)){
+
+					Port_VerificationFailures |= ((uint32)1) << Port;
+				}
+
+				else{
+					/* No Action Required */
+				}
+#endif
+			}
+
+			else{
+				/* No Action Required */
+			}
+		}
+
+#if (PORT_INIT_VERIFICATION == STD_ON)
+		if(0U != Port_VerificationFailures){
+
+			Error = TRUE;
+
+			PORT_REPORT_ERROR(PORT_RESTORE_CONTEXT_SID, PORT_E_INIT_FAILED);
+		}
 
+		else{
+			/* No Action Required */
+		}
+#endif
 	}
 
 	else{
 		/* No Action Required */
 	}
 
+	Port_Status = (FALSE == Error) ? PORT_INITIALIZED : PORT_NOT_INITIALIZED;
 
 }
-#endif
 
+#endif
 
 
 /************************************************************************************
- * Service Name: Port_SetPinMode
- * Service ID[hex]: 0x04
+ * Service Name: Port_GetEventCount
+ * Service ID[hex]: 0x11
  * Sync/Async: Synchronous
  * Reentrancy: Reentrant
- * Parameters (in): Pin - Port Pin ID number
- * 					Mode - New Port Pin mode to be set on port pin.
+ * Parameters (in): None
  * Parameters (inout): None
  * Parameters (out): None
- * Return value: None
- * Description: Sets the port pin mode.
+ * Return value: uint32 - Number of records appended to the event log since reset,
+ *                        the last PORT_EVENT_LOG_SIZE of them are kept
+ * Description: Returns the sequence number the next event record will get.
  ************************************************************************************/
 
-#if (PORT_SET_PIN_MODE_API == STD_ON)
-
-void Port_SetPinMode( Port_PinType Pin,
-		Port_PinModeType Mode ){
-
-	boolean Error = FALSE;
-
-#if (PORT_DEV_ERROR_DETECT == STD_ON)
+#if (PORT_EVENT_LOG == STD_ON)
 
-	if(PORT_NOT_INITIALIZED == Port_Status){
+uint32 Port_GetEventCount(void){
 
-		Error = TRUE;
+	return __atomic_load_n(&Port_EventHead, __ATOMIC_RELAXED);
+}
 
-		Det_ReportError(PORT_MODULE_ID,
-				PORT_INSTANCE_ID,
-				PORT_SET_PIN_MODE_SID,
-				PORT_E_UNINIT);
+/************************************************************************************
+ * Service Name: Port_GetEvent
+ * Service ID[hex]: 0x12
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Sequence - Sequence number of the record
+ * Parameters (inout): None
+ * Parameters (out): Event - Copy of the record
+ * Return value: Std_ReturnType - E_NOT_OK if the record was overwritten, is being
+ *                                written or was never written
+ * Description: Copies one record of the event log without stopping the writers.
+ ************************************************************************************/
+Std_ReturnType Port_GetEvent(uint32 Sequence, Port_EventType * Event){
 
-	}
-	else{
-		/* No Action Required */
-	}
+	Std_ReturnType Result = E_NOT_OK;
+	boolean Error = FALSE;
 
+#if (PORT_RUNTIME_CHECKS == STD_ON)
 
-	if((Pin >= PORT_NUMBER_OF_PORT_PINS) || Pin<0){
+	if(NULL_PTR == Event){
 
 		Error = TRUE;
 
-		Det_ReportError(PORT_MODULE_ID,
-				PORT_INSTANCE_ID,
-				PORT_SET_PIN_MODE_SID,
-				PORT_E_PARAM_PIN);
+		PORT_REPORT_ERROR(PORT_GET_EVENT_SID, PORT_E_PARAM_POINTER);
 	}
 
 	else{
 		/* No Action Required */
 	}
 
+#endif
 
+	if(FALSE == Error){
 
+		const Port_EventType * Record = &Port_EventLog[Sequence & (PORT_EVENT_LOG_SIZE - 1U)];
+		uint32 Tag = __atomic_load_n(&Record->Sequence, __ATOMIC_RELAXED);
 
-	if((Mode < PORT_MODE_DIO) || (Mode > PORT_MODE_ADC)){
-
-		Error = TRUE;
+		__atomic_signal_fence(__ATOMIC_ACQUIRE);
 
-		Det_ReportError(PORT_MODULE_ID,
-				PORT_INSTANCE_ID,
-				PORT_SET_PIN_MODE_SID,
-				PORT_E_PARAM_INVALID_MODE);
+		*Event = *Record;
 
-	}
+		__atomic_signal_fence(__ATOMIC_ACQUIRE);
 
-	else{
-		/* No Action Required */
-	}
+		/* The record of this sequence number, complete and not appended over while it was copied */
+		if(((Sequence + 1U) == Tag) && (Tag == __atomic_load_n(&Record->Sequence, __ATOMIC_RELAXED))){
 
-	if(PORT_PIN_MODE_NON_CHANGEABLE == Port_Pins[Pin].changeableMode){
+			Event->Sequence = Sequence;
 
-		Error = TRUE;
+			Result = E_OK;
+		}
 
-		Det_ReportError(PORT_MODULE_ID,
-				PORT_INSTANCE_ID,
-				PORT_SET_PIN_MODE_SID,
-				PORT_E_MODE_UNCHANGEABLE);
+		else{
+			/* No Action Required */
+		}
 	}
 
 	else{
 		/* No Action Required */
 	}
 
+	return Result;
+}
 
 #endif
 
-	if(FALSE == Error){
-
-		{
-			volatile uint32 * DEN_Registers[] = {&GPIO_PORTA_DEN_REG ,
-					&GPIO_PORTB_DEN_REG ,
-					&GPIO_PORTC_DEN_REG,
-					&GPIO_PORTD_DEN_REG,
-					&GPIO_PORTE_DEN_REG,
-					&GPIO_PORTF_DEN_REG};
-
-
-			volatile uint32 * AMSEL_Registers[] = {&GPIO_PORTA_AMSEL_REG ,
-					&GPIO_PORTB_AMSEL_REG ,
-					&GPIO_PORTC_AMSEL_REG,
-					&GPIO_PORTD_AMSEL_REG,
-					&GPIO_PORTE_AMSEL_REG,
-					&GPIO_PORTF_AMSEL_REG};
-
-			if(Mode == PORT_MODE_ADC){
-
-				SET_BIT(*AMSEL_Registers[Port_Pins[Pin].Port_Num] , Port_Pins[Pin].Pin_Num);
-				CLEAR_BIT(*DEN_Registers[Port_Pins[Pin].Port_Num] , Port_Pins[Pin].Pin_Num);
-			}
-
-			else{
-				CLEAR_BIT(*AMSEL_Registers[Port_Pins[Pin].Port_Num] , Port_Pins[Pin].Pin_Num);
-				SET_BIT(*DEN_Registers[Port_Pins[Pin].Port_Num] , Port_Pins[Pin].Pin_Num);
-			}
+/************************************************************************************
+ * Service Name: Port_ResetErrorCounters
+ * Service ID[hex]: 0x15
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Cyclic function that clears the error status of every service,
+ *              the next PORT_DET_RATE_LIMIT errors of each service reach Det again.
+ ************************************************************************************/
+#if (PORT_ERROR_MONITOR == STD_ON)
 
-		}
+void Port_ResetErrorCounters(void){
 
-		{
-			volatile uint32 * AFSEL_Registers[] = {&GPIO_PORTA_AFSEL_REG ,
+	for(uint8 ServiceId = 0 ; ServiceId < PORT_NUMBER_OF_SERVICES ; ServiceId++){
 
-					&GPIO_PORTB_AFSEL_REG ,
-					&GPIO_PORTC_AFSEL_REG,
-					&GPIO_PORTD_AFSEL_REG,
-					&GPIO_PORTE_AFSEL_REG,
-					&GPIO_PORTF_AFSEL_REG};
+		Port_ErrorStatus[ServiceId].Errors = 0U;
+		Port_ErrorStatus[ServiceId].Detected = 0U;
+		Port_ErrorStatus[ServiceId].Suppressed = 0U;
+	}
+}
 
-			volatile uint32 * PCTL_Registers[] = {&GPIO_PORTA_PCTL_REG ,
-					&GPIO_PORTB_PCTL_REG ,
-					&GPIO_PORTC_PCTL_REG,
-					&GPIO_PORTD_PCTL_REG,
-					&GPIO_PORTE_PCTL_REG,
-					&GPIO_PORTF_PCTL_REG};
+/************************************************************************************
+ * Service Name: Port_GetErrorStatus
+ * Service ID[hex]: 0x16
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): ServiceId - Service ID of the service
+ * Parameters (inout): None
+ * Parameters (out): Status - Errors of the service since the last Port_ResetErrorCounters
+ * Return value: Std_ReturnType - E_NOT_OK for an unknown service ID
+ * Description: Copies the error status of one service, including the errors
+ *              held back from Det by PORT_DET_RATE_LIMIT.
+ ************************************************************************************/
+Std_ReturnType Port_GetErrorStatus(uint8 ServiceId, Port_ErrorStatusType * Status){
 
-			*PCTL_Registers[Port_Pins[Pin].Port_Num] &= ~( ((uint32)0x0F) <<(4* Port_Pins[Pin].Pin_Num) ) ;
+	Std_ReturnType Result = E_NOT_OK;
+	boolean Error = FALSE;
 
-			switch(Mode){
+#if (PORT_RUNTIME_CHECKS == STD_ON)
 
-			case PORT_MODE_DIO:
-			case PORT_MODE_ADC:
+	if(NULL_PTR == Status){
 
-				CLEAR_BIT(*AFSEL_Registers[Port_Pins[Pin].Port_Num] , Port_Pins[Pin].Pin_Num);
+		Error = TRUE;
 
-				break;
+		PORT_REPORT_ERROR(PORT_GET_ERROR_STATUS_SID, PORT_E_PARAM_POINTER);
+	}
 
-			default:
+	else{
+		/* No Action Required */
+	}
 
-				SET_BIT(*AFSEL_Registers[Port_Pins[Pin].Port_Num] , Port_Pins[Pin].Pin_Num);
+#endif
 
-				*PCTL_Registers[Port_Pins[Pin].Port_Num] |= ((uint32)Mode)<<(4*Port_Pins[Pin].Pin_Num);
+	if((FALSE == Error) && (ServiceId < PORT_NUMBER_OF_SERVICES)){
 
+		*Status = Port_ErrorStatus[ServiceId];
 
-			}
-		}
+		Result = E_OK;
 	}
 
 	else{
 		/* No Action Required */
 	}
 
+	return Result;
 }
 
 #endif
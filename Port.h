@@ -42,6 +42,9 @@
 #define PORT_INITIALIZED                (1U)
 #define PORT_NOT_INITIALIZED            (0U)
 
+/* Critical pins programmed, the other pins wait for Port_MainFunction or Port_CompleteInit */
+#define PORT_INIT_PENDING               (2U)
+
 #define UNLOCKING_VALUE		     (0x4C4F434BU)
 
 /* Standard AUTOSAR types */
@@ -93,6 +96,63 @@
 /* Service ID for Port_SetPinMode*/
 #define PORT_SET_PIN_MODE_SID       		(uint8)0x04
 
+/* Service ID for Port_EnablePinInterrupts*/
+#define PORT_ENABLE_PIN_INTERRUPTS_SID       	(uint8)0x05
+
+/* Service ID for Port_DisablePinInterrupts*/
+#define PORT_DISABLE_PIN_INTERRUPTS_SID       	(uint8)0x06
+
+/* Service ID for Port_SetPinTrigger*/
+#define PORT_SET_PIN_TRIGGER_SID       		(uint8)0x07
+
+/* Service ID for Port_GetPinHandle*/
+#define PORT_GET_PIN_HANDLE_SID       		(uint8)0x08
+
+/* Service ID for Port_GetGroupHandle*/
+#define PORT_GET_GROUP_HANDLE_SID       	(uint8)0x09
+
+/* Service ID for Port_SaveContext*/
+#define PORT_SAVE_CONTEXT_SID       		(uint8)0x0A
+
+/* Service ID for Port_RestoreContext*/
+#define PORT_RESTORE_CONTEXT_SID       		(uint8)0x0B
+
+/* Service ID for Port_CompleteInit*/
+#define PORT_COMPLETE_INIT_SID       		(uint8)0x0C
+
+/* Service ID for Port_MainFunction*/
+#define PORT_MAIN_FUNCTION_SID       		(uint8)0x0D
+
+/* Service ID for Port_GetStatus*/
+#define PORT_GET_STATUS_SID       		(uint8)0x0E
+
+/* Service ID for Port_GetVerificationResult*/
+#define PORT_GET_VERIFICATION_RESULT_SID	(uint8)0x0F
+
+/* Service ID for Port_SetGroupDirection*/
+#define PORT_SET_GROUP_DIRECTION_SID		(uint8)0x10
+
+/* Service ID for Port_GetEventCount*/
+#define PORT_GET_EVENT_COUNT_SID		(uint8)0x11
+
+/* Service ID for Port_GetEvent*/
+#define PORT_GET_EVENT_SID			(uint8)0x12
+
+/* Service ID for PORT Set Pins Direction */
+#define PORT_SET_PINS_DIRECTION_SID		(uint8)0x13
+
+/* Service ID for PORT Set Mode Profile */
+#define PORT_SET_MODE_PROFILE_SID		(uint8)0x14
+
+/* Service ID for PORT Reset Error Counters */
+#define PORT_RESET_ERROR_COUNTERS_SID		(uint8)0x15
+
+/* Service ID for PORT Get Error Status */
+#define PORT_GET_ERROR_STATUS_SID		(uint8)0x16
+
+/* Number of the service IDs, the error monitor keeps a status per service */
+#define PORT_NUMBER_OF_SERVICES			(0x17U)
+
 
 /*******************************************************************************
  *                      DET Error Codes                                        *
@@ -123,6 +183,27 @@
  */
 #define PORT_E_PARAM_POINTER 		    (uint8)0x10
 
+/*
+ * The read back of a port after Port_Init differs from its configuration,
+ * e.g. a locked pin whose commit failed
+ */
+#define PORT_E_INIT_FAILED 		    (uint8)0x11
+
+/* DET code to report Invalid Pin Group ID */
+#define PORT_E_PARAM_GROUP 		    (uint8)0x12
+
+/* DET code to report pins not owned by the partition of the caller */
+#define PORT_E_PIN_NOT_OWNED 		    (uint8)0x13
+
+/* DET code to report Invalid Mode Profile ID */
+#define PORT_E_PARAM_PROFILE 		    (uint8)0x14
+
+/* DET code to report Invalid Port ID, for the services taking a port and a pin mask */
+#define PORT_E_PARAM_PORT 		    (uint8)0x15
+
+/* Bit of a DET error code in the Errors bitmask of Port_ErrorStatusType */
+#define PORT_ERROR_BIT(ErrorId)             ((uint32)1U << ((ErrorId) - PORT_E_PARAM_PIN))
+
 /*******************************************************************************
  *                              Module Data Types                              *
  *******************************************************************************/
@@ -140,6 +221,43 @@ typedef enum{
 /* Type definition for Port_PinModeType used by the PORT APIs */
 typedef uint8 Port_PinModeType;
 
+/* Type definition for the Port IDs of Port_Cfg.h used by the non AUTOSAR APIs */
+typedef uint8 Port_PortType;
+
+/* Type definition for a set of pins of one port, bit n selects pin n */
+typedef uint8 Port_PinMaskType;
+
+/* Type definition for the pin group IDs of Port_Cfg.h */
+typedef uint8 Port_GroupType;
+
+/* Type definition for the mode profile IDs of Port_Cfg.h */
+typedef uint8 Port_ProfileType;
+
+/* Type definition for the partition (OS-Application) IDs of Port_Cfg.h */
+typedef uint8 Port_PartitionType;
+
+/*
+ * Type definition for a pin handle: the GPIODATA alias whose address bits 9:2
+ * select the pins, so one access reads or writes exactly these pins
+ */
+typedef uint32 Port_PinHandleType;
+
+/* Handle returned for an invalid pin or group */
+#define PORT_INVALID_PIN_HANDLE         ((Port_PinHandleType)0U)
+
+/*
+ * Access through a pin handle: a single load or store, no read-modify-write.
+ * Bit n of the value is the level of pin n, bits of unselected pins are ignored.
+ */
+#ifdef PORT_HOST_BUILD
+#include "Port_Sim.h"
+#define PORT_WRITE_HANDLE(HANDLE, VALUE)        Port_SimWrite((HANDLE), (uint32)(VALUE))
+#define PORT_READ_HANDLE(HANDLE)                Port_SimRead(HANDLE)
+#else
+#define PORT_WRITE_HANDLE(HANDLE, VALUE)        (*((volatile uint32 *)(HANDLE)) = (uint32)(VALUE))
+#define PORT_READ_HANDLE(HANDLE)                (*((volatile uint32 *)(HANDLE)))
+#endif
+
 /* Non AUTOSAR Data-types */
 typedef enum
 {
@@ -191,6 +309,81 @@ typedef enum{
 
 }Port_PinInitialMode;
 
+typedef enum{
+
+	PORT_PIN_INTERRUPT_NONE,
+	PORT_PIN_INTERRUPT_RISING_EDGE,
+	PORT_PIN_INTERRUPT_FALLING_EDGE,
+	PORT_PIN_INTERRUPT_BOTH_EDGES,
+	PORT_PIN_INTERRUPT_LOW_LEVEL,
+	PORT_PIN_INTERRUPT_HIGH_LEVEL
+
+}Port_PinInterruptType;
+
+typedef enum{
+
+	PORT_PIN_DRIVE_2MA,
+	PORT_PIN_DRIVE_4MA,
+	PORT_PIN_DRIVE_8MA
+
+}Port_PinDriveStrength;
+
+/* Slew rate control is only available with the 8mA drive */
+typedef enum{
+
+	PORT_PIN_SLEW_RATE_FAST,
+	PORT_PIN_SLEW_RATE_CONTROLLED
+
+}Port_PinSlewRate;
+
+typedef enum{
+
+	PORT_PIN_OUTPUT_PUSH_PULL,
+	PORT_PIN_OUTPUT_OPEN_DRAIN
+
+}Port_PinOutputType;
+
+/*
+ * Hardware triggers raised by the pin through GPIOADCCTL/GPIODMACTL.
+ * The trigger fires on the interrupt sense of the pin (see Port_PinInterruptType),
+ * whether or not its interrupt is armed.
+ */
+typedef enum{
+
+	PORT_PIN_TRIGGER_NONE,
+	PORT_PIN_TRIGGER_ADC,
+	PORT_PIN_TRIGGER_DMA,
+	PORT_PIN_TRIGGER_ADC_AND_DMA
+
+}Port_PinTriggerType;
+
+/* Critical pins are programmed by Port_Init before any other pin, e.g. outputs with a safe level */
+typedef enum{
+
+	PORT_PIN_PRIORITY_NORMAL,
+	PORT_PIN_PRIORITY_CRITICAL
+
+}Port_PinPriorityType;
+
+/* Description of one GPIO port of the selected device, see Port_Regs.h */
+typedef struct
+{
+	/* Base address of the port register block */
+	uint32 BaseAddress;
+
+	uint8 NumberOfPins;
+
+	/* Pins committed only after the GPIOLOCK/GPIOCR unlock sequence */
+	uint8 LockedPins;
+
+	/* Pins the driver never unlocks (JTAG) */
+	uint8 ReservedPins;
+
+	/* Pins that can be used in PORT_MODE_ADC */
+	uint8 AnalogPins;
+
+}Port_DeviceDescriptorType;
+
 typedef struct
 {
 
@@ -210,17 +403,264 @@ typedef struct
 
 	Port_PinDirectionChangeable changeableDirection;
 
+	Port_PinInterruptType interrupt;
+
+	Port_PinDriveStrength drive;
+
+	Port_PinSlewRate slewRate;
+
+	Port_PinOutputType outputType;
+
+	Port_PinTriggerType trigger;
+
+	Port_PinPriorityType priority;
 
 }Port_ConfigPin;
 
+/*
+ * Named set of pins of one port switched together by Port_SetGroupDirection,
+ * every pin of the group is configured with PORT_PIN_DIRECTION_CHANGEABLE
+ */
+typedef struct
+{
+	Port_PortType Port;
+
+	Port_PinMaskType Pins;
+
+}Port_ConfigGroup;
+
+/*
+ * Mode profile switched by Port_SetModeProfile: one mode for a set of pins on
+ * any ports, every pin of the profile is configured with PORT_PIN_MODE_CHANGEABLE
+ */
+typedef struct
+{
+	Port_PinModeType Mode;
+
+	/* Pins of every port in the mode, bit n for pin n */
+	Port_PinMaskType Pins[PORT_NUMBER_OF_PORTS];
+
+}Port_ConfigProfile;
+
+/*
+ * Pins owned by one partition, one word per port with bit n for pin n, so the
+ * runtime services check the caller with a single AND
+ */
+typedef struct
+{
+	uint32 Pins[PORT_NUMBER_OF_PORTS];
+
+}Port_ConfigPartition;
+
 
 /* Data Structure required for initializing the Port Driver */
 typedef struct Port_ConfigType
 {
 	Port_ConfigPin Pins[PORT_NUMBER_OF_PORT_PINS];
 
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+	Port_ConfigGroup Groups[PORT_NUMBER_OF_PIN_GROUPS];
+#endif
+
+#if (PORT_MODE_PROFILE_API == STD_ON)
+	Port_ConfigProfile Profiles[PORT_NUMBER_OF_MODE_PROFILES];
+#endif
+
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+	Port_ConfigPartition Partitions[PORT_NUMBER_OF_PARTITIONS];
+#endif
+
 } Port_ConfigType;
 
+#if (PORT_CONFIG_VARIANT == PORT_VARIANT_PRE_COMPILE)
+/*
+ * Initializers of Port_ConfigType.Profiles and Port_ConfigType.Partitions from the
+ * PORT_PRECOMPILE_* lists of Port_Cfg.h, with one pin mask for every port of
+ * PORT_DEVICE_PORT_LIST. They are expanded where Port_Regs.h is included.
+ */
+#define PORT_PRECOMPILE_ENTRY_OF(ID, PORT)            (ID)
+#define PORT_PRECOMPILE_PORT_OF(ID, PORT)             (PORT)
+#define PORT_PRECOMPILE_PINS_OF(ARG, ID, PORT, PINS) \
+		| ((((ID) == PORT_PRECOMPILE_ENTRY_OF ARG) && ((PORT) == PORT_PRECOMPILE_PORT_OF ARG)) ? ((uint32)(PINS)) : 0U)
+
+#define PORT_PRECOMPILE_PROFILE_PORT(ARG, ID, BASE, PINS, LOCKED, RESERVED, ANALOG) \
+		(Port_PinMaskType)(0U PORT_PRECOMPILE_PROFILE_PINS(PORT_PRECOMPILE_PINS_OF, (ARG, ID))),
+#define PORT_PRECOMPILE_PROFILE(ARG, ID, MODE) \
+		[ID] = { MODE, { PORT_DEVICE_PORT_LIST(PORT_PRECOMPILE_PROFILE_PORT, ID) } },
+
+#define PORT_PRECOMPILE_PARTITION_PORT(ARG, ID, BASE, PINS, LOCKED, RESERVED, ANALOG) \
+		(uint32)(0U PORT_PRECOMPILE_PARTITION_PINS(PORT_PRECOMPILE_PINS_OF, (ARG, ID))),
+#define PORT_PRECOMPILE_PARTITION(ARG, ID) \
+		[ID] = { { PORT_DEVICE_PORT_LIST(PORT_PRECOMPILE_PARTITION_PORT, ID) } },
+
+#define PORT_PRECOMPILE_PROFILE_TABLE        { PORT_PRECOMPILE_MODE_PROFILES(PORT_PRECOMPILE_PROFILE, 0U) }
+#define PORT_PRECOMPILE_PARTITION_TABLE      { PORT_PRECOMPILE_PARTITIONS(PORT_PRECOMPILE_PARTITION, 0U) }
+#endif
+
+/* First word of a configuration image, "PCFG" */
+#define PORT_CONFIG_IMAGE_MAGIC                 (0x50434647U)
+
+/* Layout of Port_ConfigImageType, raised with every change of Port_ConfigType */
+#define PORT_CONFIG_IMAGE_FORMAT_VERSION        (3U)
+
+/* Header of a binary configuration image, see port_cfgimage */
+typedef struct
+{
+	/* PORT_CONFIG_IMAGE_MAGIC */
+	uint32 Magic;
+
+	/* PORT_CONFIG_IMAGE_FORMAT_VERSION of the tool that built the image */
+	uint16 FormatVersion;
+
+	/* PORT_NUMBER_OF_PORT_PINS of the configuration */
+	uint16 PinCount;
+
+	/* PORT_SW_* and PORT_AR_RELEASE_* versions the configuration was built for */
+	uint8 SwMajorVersion;
+
+	uint8 SwMinorVersion;
+
+	uint8 SwPatchVersion;
+
+	uint8 ArMajorVersion;
+
+	uint8 ArMinorVersion;
+
+	uint8 ArPatchVersion;
+
+	/* PORT_NUMBER_OF_PIN_GROUPS of the configuration, 0 without the groups */
+	uint16 GroupCount;
+
+	/* Size of the configuration following the header, sizeof(Port_ConfigType) */
+	uint32 PayloadSize;
+
+	/* CRC-32 (IEEE 802.3) of the PayloadSize bytes of the configuration */
+	uint32 Crc;
+
+}Port_ConfigImageHeaderType;
+
+/* Binary configuration image: Port_Init is given &Config and reads it in place */
+typedef struct
+{
+	Port_ConfigImageHeaderType Header;
+
+	Port_ConfigType Config;
+
+}Port_ConfigImageType;
+
+/* Saved GPIO registers of one port, see Port_SaveContext */
+typedef struct
+{
+	uint32 Data;
+
+	uint32 Dir;
+
+	uint32 Is;
+
+	uint32 Ibe;
+
+	uint32 Iev;
+
+	uint32 Im;
+
+	uint32 Afsel;
+
+	uint32 Dr2r;
+
+	uint32 Dr4r;
+
+	uint32 Dr8r;
+
+	uint32 Odr;
+
+	uint32 Pur;
+
+	uint32 Pdr;
+
+	uint32 Slr;
+
+	uint32 Den;
+
+	uint32 Amsel;
+
+	uint32 Pctl;
+
+	uint32 Adcctl;
+
+	uint32 Dmactl;
+
+}Port_PortContextType;
+
+/* Old value of an event record whose call was rejected */
+#define PORT_EVENT_VALUE_UNKNOWN        ((uint8)0xFFU)
+
+/* One call of Port_SetPinDirection or Port_SetPinMode, see Port_GetEvent */
+typedef struct
+{
+	/* Number of the record, the first record after reset is 0 */
+	uint32 Sequence;
+
+	/* PORT_EVENT_LOG_TIMESTAMP() when the call was recorded */
+	uint32 Timestamp;
+
+	uint8 ServiceId;
+
+	/* 0 for an applied call, else the DET error code the call was rejected with */
+	uint8 ErrorId;
+
+	Port_PinType Pin;
+
+	/* Direction or mode of the pin before and after the call */
+	uint8 OldValue;
+
+	uint8 NewValue;
+
+}Port_EventType;
+
+/* Errors of one service since the last Port_ResetErrorCounters, see Port_GetErrorStatus */
+typedef struct
+{
+	/* PORT_ERROR_BIT() of every error code detected */
+	uint32 Errors;
+
+	/* Calls rejected with an error, saturating at 0xFFFF */
+	uint16 Detected;
+
+	/* Those of them not reported to Det because of PORT_DET_RATE_LIMIT */
+	uint16 Suppressed;
+
+}Port_ErrorStatusType;
+
+/* First word of a saved context, "PCTX" */
+#define PORT_CONTEXT_MAGIC                      (0x50435458U)
+
+/* Layout of Port_ContextType, raised with every change of it */
+#define PORT_CONTEXT_FORMAT_VERSION             (1U)
+
+/*
+ * Context of the driver saved before hibernation, to be placed by the caller
+ * in memory retained across the hibernation (e.g. the hibernation module memory)
+ */
+typedef struct
+{
+	/* PORT_CONTEXT_MAGIC and PORT_CONTEXT_FORMAT_VERSION, a context never saved is rejected */
+	uint32 Magic;
+
+	uint32 FormatVersion;
+
+	/* Configuration the driver was initialized with, NULL_PTR in the pre-compile variant */
+	const Port_ConfigType * ConfigPtr;
+
+	/* Ports saved in Ports[], bit n for port n */
+	uint32 SavedPorts;
+
+	Port_PortContextType Ports[PORT_NUMBER_OF_PORTS];
+
+	/* CRC-32 of the members above, checked by Port_RestoreContext */
+	uint32 Crc;
+
+}Port_ContextType;
+
 
 /*******************************************************************************
  *                      Function Prototypes                                    *
@@ -229,11 +669,37 @@ typedef struct Port_ConfigType
 /* Function for PORT Init API */
 void Port_Init(const Port_ConfigType* ConfigPtr) ;
 
+#if (PORT_DEFERRED_INIT == STD_ON)
+/* Function for PORT Complete Init API */
+void Port_CompleteInit(void);
+
+/* Function for PORT Main Function, called cyclically */
+void Port_MainFunction(void);
+#endif
+
+/* Function for PORT Get Status API */
+uint8 Port_GetStatus(void);
+
+#if (PORT_INIT_VERIFICATION == STD_ON)
+/* Function for PORT Get Verification Result API */
+uint32 Port_GetVerificationResult(void);
+#endif
+
 #if (PORT_SET_PIN_DIRECTION_API == STD_ON)
 /* Function for PORT Set Pin Direction API */
 void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction);
 #endif
 
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+/* Function for PORT Set Group Direction API */
+void Port_SetGroupDirection(Port_GroupType Group, Port_PinDirectionType Direction);
+#endif
+
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+/* Function for PORT Set Pins Direction API */
+void Port_SetPinsDirection(Port_PortType Port, Port_PinMaskType Pins, Port_PinMaskType Outputs);
+#endif
+
 /* Function for PORT Refresh Port Direction API */
 void Port_RefreshPortDirection(void) ;
 
@@ -249,11 +715,73 @@ void Port_GetVersionInfo(Std_VersionInfoType* versioninfo) ;
 void Port_SetPinMode( Port_PinType Pin, Port_PinModeType Mode );
 #endif
 
+#if (PORT_MODE_PROFILE_API == STD_ON)
+/* Function for PORT Set Mode Profile API */
+void Port_SetModeProfile(Port_ProfileType Profile);
+#endif
+
+#if (PORT_PIN_INTERRUPT_API == STD_ON)
+/* Function for PORT Enable Pin Interrupts API */
+void Port_EnablePinInterrupts(Port_PortType Port, Port_PinMaskType Pins);
+
+/* Function for PORT Disable Pin Interrupts API */
+void Port_DisablePinInterrupts(Port_PortType Port, Port_PinMaskType Pins);
+#endif
+
+#if (PORT_SET_PIN_TRIGGER_API == STD_ON)
+/* Function for PORT Set Pin Trigger API */
+void Port_SetPinTrigger(Port_PinType Pin, Port_PinTriggerType Trigger);
+#endif
+
+#if (PORT_PIN_HANDLE_API == STD_ON)
+/* Function for PORT Get Pin Handle API */
+Port_PinHandleType Port_GetPinHandle(Port_PinType Pin);
+
+/* Function for PORT Get Group Handle API */
+Port_PinHandleType Port_GetGroupHandle(Port_PortType Port, Port_PinMaskType Pins);
+#endif
+
+#if (PORT_CONTEXT_API == STD_ON)
+/* Function for PORT Save Context API */
+void Port_SaveContext(Port_ContextType * Context);
+
+/* Function for PORT Restore Context API */
+void Port_RestoreContext(const Port_ContextType * Context);
+#endif
+
+#if (PORT_EVENT_LOG == STD_ON)
+/* Function for PORT Get Event Count API */
+uint32 Port_GetEventCount(void);
+
+/* Function for PORT Get Event API */
+Std_ReturnType Port_GetEvent(uint32 Sequence, Port_EventType * Event);
+#endif
+
+#if (PORT_ERROR_MONITOR == STD_ON)
+/* Function for PORT Reset Error Counters API, called cyclically */
+void Port_ResetErrorCounters(void);
+
+/* Function for PORT Get Error Status API */
+Std_ReturnType Port_GetErrorStatus(uint8 ServiceId, Port_ErrorStatusType * Status);
+#endif
+
 /*******************************************************************************
  *                       External Variables                                    *
  *******************************************************************************/
 
+#if (PORT_CONFIG_VARIANT == PORT_VARIANT_POST_BUILD)
 /* Extern PB structures to be used by Port and other modules */
 extern const Port_ConfigType Port_Configuration;
 
+#if (PORT_CONFIG_IMAGE_SUPPORT == STD_ON)
+/*
+ * Slot of the configuration image, defined by the ECU linker script at the start
+ * of its own NOLOAD flash section (e.g. .port_config) so that flashing the
+ * application keeps the image. Port_Init(&Port_ConfigImage.Config) fails while
+ * the slot holds no valid image, the application then falls back to Port_Configuration.
+ */
+extern const Port_ConfigImageType Port_ConfigImage;
+#endif
+#endif
+
 #endif /* PORT_H_ */
@@ -27,6 +27,16 @@
 #define PORT_CFG_AR_RELEASE_PATCH_VERSION     (3U)
 
 
+/* Supported Microcontrollers */
+#define PORT_DEVICE_TM4C123GH6PM             (0U)
+#define PORT_DEVICE_TM4C1294NCPDT            (1U)
+
+/* Host only: 18 synthetic ports of 8 pins, used by the scaling benchmark */
+#define PORT_DEVICE_HOST_SCALE               (2U)
+
+/* Pre-compile option for the target Microcontroller */
+#define PORT_DEVICE                          (PORT_DEVICE_TM4C123GH6PM)
+
 /* Pre-compile option for Development Error Detect */
 #define PORT_DEV_ERROR_DETECT                (STD_ON)
 
@@ -38,6 +48,101 @@
 
 /* Pre-compile option for Set Pin Mode API */
 #define PORT_SET_PIN_MODE_API		     (STD_ON)
+
+/* Pre-compile option for Enable/Disable Pin Interrupts APIs */
+#define PORT_PIN_INTERRUPT_API		     (STD_ON)
+
+/* Pre-compile option for Set Pin Trigger API */
+#define PORT_SET_PIN_TRIGGER_API	     (STD_ON)
+
+/* Pre-compile option for Set Group Direction API, needs at least one pin group */
+#define PORT_SET_GROUP_DIRECTION_API	     (STD_ON)
+
+/* Pre-compile option for Set Mode Profile API, needs at least one mode profile */
+#define PORT_MODE_PROFILE_API		     (STD_ON)
+
+/* Pre-compile option for Get Pin/Group Handle APIs */
+#define PORT_PIN_HANDLE_API		     (STD_ON)
+
+/* Pre-compile option for Save/Restore Context APIs */
+#define PORT_CONTEXT_API		     (STD_ON)
+
+/*
+ * Pre-compile option for the deferred init: Port_Init only programs the
+ * critical pins and Port_MainFunction or Port_CompleteInit the others,
+ * otherwise Port_Init programs the critical pins first and then the others
+ */
+#define PORT_DEFERRED_INIT		     (STD_OFF)
+
+/* Ports programmed by one Port_MainFunction call with the deferred init */
+#define PORT_INIT_PORTS_PER_MAIN_FUNCTION    (2U)
+
+/*
+ * Pre-compile option for the warm reset check: after a warm reset Port_Init
+ * reads back every port and leaves the ports already holding their image
+ */
+#define PORT_WARM_RESET_CHECK		     (STD_OFF)
+
+/* Linker section left alone by the startup code, holding the warm reset record */
+#define PORT_RETAINED_SECTION                ".noinit"
+
+/*
+ * Pre-compile option for the init verification: once all the pins are
+ * programmed, every port is read back once and a port differing from its
+ * configuration is reported to Det and by Port_GetVerificationResult
+ */
+#define PORT_INIT_VERIFICATION		     (STD_OFF)
+
+/*
+ * Pre-compile option for the event log: Port_SetPinDirection and Port_SetPinMode
+ * append a record of every call, applied or rejected, read by Port_GetEvent
+ */
+#define PORT_EVENT_LOG			     (STD_OFF)
+
+/* Records kept by the event log, a power of two */
+#define PORT_EVENT_LOG_SIZE                  (32U)
+
+/* Timestamp of the event log records, the cycle counter unless the application has a better clock */
+#define PORT_EVENT_LOG_TIMESTAMP()           PORT_CYCLE_COUNTER()
+
+/*
+ * Pre-compile option for the binary configuration images: Port_Init also
+ * accepts the Port_ConfigType of a Port_ConfigImageType flashed on its own,
+ * once the header and the CRC of the image are checked
+ */
+#define PORT_CONFIG_IMAGE_SUPPORT	     (STD_OFF)
+
+/*
+ * Pre-compile option for the pin ownership: the configuration gives every
+ * partition (OS-Application) the pins it owns on each port, the runtime
+ * services only change the pins owned by the partition of their caller
+ */
+#define PORT_PIN_OWNERSHIP		     (STD_OFF)
+
+/* Partition of the caller of a runtime service, its OS-Application unless the ECU maps them otherwise */
+#define PORT_GET_CURRENT_PARTITION()         PORT_OS_APPLICATION_ID()
+
+/*
+ * Pre-compile option for the error monitor: the runtime services count the
+ * errors they detect per service and collect them in a bitmask read by
+ * Port_GetErrorStatus, Det only receives the first PORT_DET_RATE_LIMIT of
+ * them between two Port_ResetErrorCounters calls
+ */
+#define PORT_ERROR_MONITOR		     (STD_OFF)
+
+/* Errors reported to Det per service between two Port_ResetErrorCounters calls, 0 for no limit */
+#define PORT_DET_RATE_LIMIT                  (4U)
+
+/* Configuration variants */
+#define PORT_VARIANT_PRE_COMPILE             (0U)
+#define PORT_VARIANT_POST_BUILD              (1U)
+
+/*
+ * Pre-compile option for the configuration variant: the post-build variant
+ * reads the pins from the Port_ConfigType passed to Port_Init (Port_PBcfg.c),
+ * the pre-compile variant builds Port_Init from PORT_PRECOMPILE_PINS below.
+ */
+#define PORT_CONFIG_VARIANT                  (PORT_VARIANT_POST_BUILD)
 /******************************************/
 
 /* Number of the configured Port Pins */
@@ -46,6 +151,113 @@
 /* Number of the configured Ports */
 #define PORT_NUMBER_OF_PORTS			    (6u)
 
+/* Number of the configured pin groups */
+#define PORT_NUMBER_OF_PIN_GROUPS		    (1u)
+
+/* Number of the configured mode profiles */
+#define PORT_NUMBER_OF_MODE_PROFILES		    (2u)
+
+/* Number of the partitions owning pins */
+#define PORT_NUMBER_OF_PARTITIONS		    (2u)
+
+#if (PORT_CONFIG_VARIANT == PORT_VARIANT_PRE_COMPILE)
+/*
+ * Pins of the pre-compile variant, PORT_NUMBER_OF_PORT_PINS entries with the
+ * columns of Port_ConfigPin:
+ * PIN(ARG, Port, Pin, Mode, Initial Level, Direction, Resistance, Mode Changeable,
+ *     Direction Changeable, Interrupt, Drive, Slew Rate, Output Type, Trigger, Priority)
+ */
+#define PORT_PRECOMPILE_PINS(PIN, ARG) \
+		PIN(ARG, PORT_PORTA_ID, PORT_PIN0_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTA_ID, PORT_PIN1_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTA_ID, PORT_PIN2_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTA_ID, PORT_PIN3_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTA_ID, PORT_PIN4_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTA_ID, PORT_PIN5_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTA_ID, PORT_PIN6_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTA_ID, PORT_PIN7_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		\
+		PIN(ARG, PORT_PORTB_ID, PORT_PIN0_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTB_ID, PORT_PIN1_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTB_ID, PORT_PIN2_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTB_ID, PORT_PIN3_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTB_ID, PORT_PIN4_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTB_ID, PORT_PIN5_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTB_ID, PORT_PIN6_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTB_ID, PORT_PIN7_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		\
+		PIN(ARG, PORT_PORTC_ID, PORT_PIN0_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTC_ID, PORT_PIN1_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTC_ID, PORT_PIN2_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTC_ID, PORT_PIN3_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTC_ID, PORT_PIN4_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTC_ID, PORT_PIN5_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTC_ID, PORT_PIN6_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTC_ID, PORT_PIN7_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		\
+		PIN(ARG, PORT_PORTD_ID, PORT_PIN0_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTD_ID, PORT_PIN1_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTD_ID, PORT_PIN2_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTD_ID, PORT_PIN3_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTD_ID, PORT_PIN4_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTD_ID, PORT_PIN5_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTD_ID, PORT_PIN6_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTD_ID, PORT_PIN7_ID, PORT_MODE_ALT14, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		\
+		PIN(ARG, PORT_PORTE_ID, PORT_PIN0_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTE_ID, PORT_PIN1_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTE_ID, PORT_PIN2_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTE_ID, PORT_PIN3_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTE_ID, PORT_PIN4_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTE_ID, PORT_PIN5_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		\
+		PIN(ARG, PORT_PORTF_ID, PORT_PIN0_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTF_ID, PORT_PIN1_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_OUT, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_CRITICAL) \
+		PIN(ARG, PORT_PORTF_ID, PORT_PIN2_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTF_ID, PORT_PIN3_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW, PORT_PIN_IN, PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL) \
+		PIN(ARG, PORT_PORTF_ID, PORT_PIN4_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_HIGH, PORT_PIN_IN, PORT_RESISTANCE_PULL_UP, PORT_PIN_MODE_NON_CHANGEABLE, PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_FALLING_EDGE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL)
+
+/*
+ * Pin groups of the pre-compile variant, PORT_NUMBER_OF_PIN_GROUPS entries in
+ * the order of the group IDs: GROUP(ARG, Port, Pins)
+ */
+#define PORT_PRECOMPILE_GROUPS(GROUP, ARG) \
+		GROUP(ARG, PORT_PORTB_ID, 0xFFU)
+
+/*
+ * Mode profiles of the pre-compile variant, PORT_NUMBER_OF_MODE_PROFILES entries:
+ * PROFILE(ARG, Profile ID, Mode)
+ */
+#define PORT_PRECOMPILE_MODE_PROFILES(PROFILE, ARG) \
+		PROFILE(ARG, 0U, PORT_MODE_ADC) \
+		PROFILE(ARG, 1U, PORT_MODE_DIO)
+
+/*
+ * Pins of the mode profiles on any port of the device, the entries of one
+ * profile and port are ORed: PINS(ARG, Profile ID, Port, Pins)
+ */
+#define PORT_PRECOMPILE_PROFILE_PINS(PINS, ARG) \
+		PINS(ARG, 0U, PORT_PORTE_ID, 0x0FU) \
+		PINS(ARG, 1U, PORT_PORTE_ID, 0x0FU)
+
+/*
+ * Partitions owning pins in the pre-compile variant, PORT_NUMBER_OF_PARTITIONS
+ * entries: PARTITION(ARG, Partition ID)
+ */
+#define PORT_PRECOMPILE_PARTITIONS(PARTITION, ARG) \
+		PARTITION(ARG, 0U) \
+		PARTITION(ARG, 1U)
+
+/*
+ * Pins owned by the partitions on any port of the device, the entries of one
+ * partition and port are ORed: PINS(ARG, Partition ID, Port, Pins)
+ */
+#define PORT_PRECOMPILE_PARTITION_PINS(PINS, ARG) \
+		PINS(ARG, 0U, PORT_PORTB_ID, 0xFFU) \
+		PINS(ARG, 1U, PORT_PORTE_ID, 0x3FU) \
+		PINS(ARG, 1U, PORT_PORTF_ID, 0x12U)
+#endif
+
 /* PORT IDs */
 #define PORT_PORTA_ID         0
 #define PORT_PORTB_ID         1
@@ -54,6 +266,17 @@
 #define PORT_PORTE_ID         4
 #define PORT_PORTF_ID         5
 
+/* TM4C129 only ports */
+#define PORT_PORTG_ID         6
+#define PORT_PORTH_ID         7
+#define PORT_PORTJ_ID         8
+#define PORT_PORTK_ID         9
+#define PORT_PORTL_ID         10
+#define PORT_PORTM_ID         11
+#define PORT_PORTN_ID         12
+#define PORT_PORTP_ID         13
+#define PORT_PORTQ_ID         14
+
 /* Pin IDs */
 #define PORT_PIN0_ID          0
 #define PORT_PIN1_ID          1
@@ -64,4 +287,15 @@
 #define PORT_PIN6_ID          6
 #define PORT_PIN7_ID          7
 
+/* Pin group IDs */
+#define PORT_GROUP_PARALLEL_BUS_ID      0
+
+/* Mode profile IDs */
+#define PORT_PROFILE_SENSE_ID           0
+#define PORT_PROFILE_DRIVE_ID           1
+
+/* Partition IDs */
+#define PORT_PARTITION_BUS_ID           0
+#define PORT_PARTITION_HMI_ID           1
+
 #endif /* PORT_CFG_H_ */
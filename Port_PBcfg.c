@@ -39,56 +39,86 @@
 #error "The SW version of PBcfg.c does not match the expected version"
 #endif
 
+#if (PORT_CONFIG_VARIANT == PORT_VARIANT_POST_BUILD)
+
 /* PB structure used with Dio_Init API */
 const Port_ConfigType Port_Configuration = {
 
-		PORT_PORTA_ID, PORT_PIN0_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTA_ID, PORT_PIN1_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTA_ID, PORT_PIN2_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTA_ID, PORT_PIN3_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTA_ID, PORT_PIN4_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTA_ID, PORT_PIN5_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTA_ID, PORT_PIN6_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTA_ID, PORT_PIN7_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-
-		PORT_PORTB_ID, PORT_PIN0_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTB_ID, PORT_PIN1_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTB_ID, PORT_PIN2_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTB_ID, PORT_PIN3_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTB_ID, PORT_PIN4_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTB_ID, PORT_PIN5_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTB_ID, PORT_PIN6_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTB_ID, PORT_PIN7_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-
-		PORT_PORTC_ID, PORT_PIN0_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTC_ID, PORT_PIN1_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTC_ID, PORT_PIN2_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTC_ID, PORT_PIN3_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTC_ID, PORT_PIN4_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTC_ID, PORT_PIN5_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTC_ID, PORT_PIN6_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTC_ID, PORT_PIN7_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-
-		PORT_PORTD_ID, PORT_PIN0_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTD_ID, PORT_PIN1_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTD_ID, PORT_PIN2_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTD_ID, PORT_PIN3_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTD_ID, PORT_PIN4_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTD_ID, PORT_PIN5_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTD_ID, PORT_PIN6_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTD_ID, PORT_PIN7_ID, PORT_MODE_ALT14, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-
-		PORT_PORTE_ID, PORT_PIN0_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTE_ID, PORT_PIN1_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTE_ID, PORT_PIN2_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTE_ID, PORT_PIN3_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTE_ID, PORT_PIN4_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTE_ID, PORT_PIN5_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-
-		PORT_PORTF_ID, PORT_PIN0_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-/*LED*/		PORT_PORTF_ID, PORT_PIN1_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_OUT , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTF_ID, PORT_PIN2_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-		PORT_PORTF_ID, PORT_PIN3_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE,
-/*Button*/	PORT_PORTF_ID, PORT_PIN4_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_HIGH , PORT_PIN_IN , PORT_RESISTANCE_PULL_UP, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE
+		/* Pins */
+		{
+		{PORT_PORTA_ID, PORT_PIN0_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTA_ID, PORT_PIN1_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTA_ID, PORT_PIN2_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTA_ID, PORT_PIN3_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTA_ID, PORT_PIN4_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTA_ID, PORT_PIN5_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTA_ID, PORT_PIN6_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTA_ID, PORT_PIN7_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+
+		{PORT_PORTB_ID, PORT_PIN0_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTB_ID, PORT_PIN1_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTB_ID, PORT_PIN2_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTB_ID, PORT_PIN3_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTB_ID, PORT_PIN4_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTB_ID, PORT_PIN5_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTB_ID, PORT_PIN6_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTB_ID, PORT_PIN7_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+
+		{PORT_PORTC_ID, PORT_PIN0_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTC_ID, PORT_PIN1_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTC_ID, PORT_PIN2_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTC_ID, PORT_PIN3_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTC_ID, PORT_PIN4_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTC_ID, PORT_PIN5_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTC_ID, PORT_PIN6_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTC_ID, PORT_PIN7_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+
+		{PORT_PORTD_ID, PORT_PIN0_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTD_ID, PORT_PIN1_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTD_ID, PORT_PIN2_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTD_ID, PORT_PIN3_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTD_ID, PORT_PIN4_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTD_ID, PORT_PIN5_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTD_ID, PORT_PIN6_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTD_ID, PORT_PIN7_ID, PORT_MODE_ALT14, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+
+		{PORT_PORTE_ID, PORT_PIN0_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_CHANGEABLE     , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTE_ID, PORT_PIN1_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_CHANGEABLE     , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTE_ID, PORT_PIN2_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_CHANGEABLE     , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTE_ID, PORT_PIN3_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_CHANGEABLE     , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTE_ID, PORT_PIN4_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTE_ID, PORT_PIN5_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+
+		{PORT_PORTF_ID, PORT_PIN0_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+/*LED*/		{PORT_PORTF_ID, PORT_PIN1_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_OUT , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_CRITICAL},
+		{PORT_PORTF_ID, PORT_PIN2_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		{PORT_PORTF_ID, PORT_PIN3_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_LOW , PORT_PIN_IN , PORT_RESISTANCE_OFF, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+/*Button*/	{PORT_PORTF_ID, PORT_PIN4_ID, PORT_MODE_DIO, PORT_PIN_LEVEL_HIGH , PORT_PIN_IN , PORT_RESISTANCE_PULL_UP, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_FALLING_EDGE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},
+		},
+
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+		/* Pin groups */
+		{
+/*Bus*/		{PORT_PORTB_ID, 0xFFU},
+		},
+#endif
+
+#if (PORT_MODE_PROFILE_API == STD_ON)
+		/* Mode profiles: the analog inputs PE0-PE3 sensing, then driving */
+		{
+/*Sense*/	{PORT_MODE_ADC, {0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x00U}},
+/*Drive*/	{PORT_MODE_DIO, {0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x00U}},
+		},
+#endif
+
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+		/* Pins owned by the partitions on ports A to F */
+		{
+/*Bus*/		{{0x00U, 0xFFU, 0x00U, 0x00U, 0x00U, 0x00U}},
+/*HMI*/		{{0x00U, 0x00U, 0x00U, 0x00U, 0x3FU, 0x12U}},
+		},
+#endif
 
 };
+
+#endif
@@ -4,7 +4,7 @@
  *
  * File Name: Port_Regs.h
  *
- * Description: Header file for TM4C123GH6PM Microcontroller - Port Driver Registers
+ * Description: Header file for TM4C123GH6PM and TM4C1294NCPDT Microcontrollers - Port Driver Registers
  *
  * Author: Hussam Wael
  ******************************************************************************/
@@ -13,91 +13,190 @@
 #define PORT_REGS_H_
 
 /*******************************************************************************
- *                            PORTA Registers                                  *
+ *                            Register Access                                  *
  *******************************************************************************/
-#define GPIO_PORTA_DATA_REG       (*((volatile uint32 *)0x400043FC))
-#define GPIO_PORTA_DIR_REG        (*((volatile uint32 *)0x40004400))
-#define GPIO_PORTA_AFSEL_REG      (*((volatile uint32 *)0x40004420))
-#define GPIO_PORTA_PUR_REG        (*((volatile uint32 *)0x40004510))
-#define GPIO_PORTA_PDR_REG        (*((volatile uint32 *)0x40004514))
-#define GPIO_PORTA_DEN_REG        (*((volatile uint32 *)0x4000451C))
-#define GPIO_PORTA_LOCK_REG       (*((volatile uint32 *)0x40004520))
-#define GPIO_PORTA_CR_REG         (*((volatile uint32 *)0x40004524))
-#define GPIO_PORTA_AMSEL_REG      (*((volatile uint32 *)0x40004528))
-#define GPIO_PORTA_PCTL_REG       (*((volatile uint32 *)0x4000452C))
+#ifdef PORT_HOST_BUILD
+/* Host builds redirect every register access to the simulated register file */
+#include "Port_Sim.h"
+#define PORT_REG_READ(ADDRESS)                 Port_SimRead(ADDRESS)
+#define PORT_REG_WRITE(ADDRESS, VALUE)         Port_SimWrite((ADDRESS), (VALUE))
+#define PORT_CYCLE_COUNTER()                   Port_SimGetCycleCount()
+#define PORT_OS_APPLICATION_ID()               Port_SimGetApplicationId()
+#define PORT_ENTER_EXCLUSIVE_AREA()            Port_SimEnterExclusiveArea()
+#define PORT_EXIT_EXCLUSIVE_AREA()             Port_SimExitExclusiveArea()
+#else
+#define PORT_REG_READ(ADDRESS)                 (*((volatile uint32 *)(ADDRESS)))
+#define PORT_REG_WRITE(ADDRESS, VALUE)         (*((volatile uint32 *)(ADDRESS)) = (VALUE))
 
+/* DWT_CYCCNT of the Cortex-M4, counting once the application sets DEMCR.TRCENA and DWT_CTRL.CYCCNTENA */
+#define PORT_CYCLE_COUNTER()                   (*((volatile uint32 *)0xE0001004U))
+
+/* OS-Application running the caller, GetApplicationID of the AUTOSAR OS (Os.h) */
+#define PORT_OS_APPLICATION_ID()               ((uint8)GetApplicationID())
+
+/* Exclusive area of the BSW scheduler (SchM_Port.h) around the update of the GPIOIM shadow */
+#define PORT_ENTER_EXCLUSIVE_AREA()            SchM_Enter_Port_PORT_EXCLUSIVE_AREA_0()
+#define PORT_EXIT_EXCLUSIVE_AREA()             SchM_Exit_Port_PORT_EXCLUSIVE_AREA_0()
+#endif
+
+/* Read-modify-write of the register bits selected by MASK */
+#define PORT_REG_MODIFY(ADDRESS, MASK, VALUE)  PORT_REG_WRITE((ADDRESS), \
+		((PORT_REG_READ(ADDRESS) & ~((uint32)(MASK))) | (((uint32)(VALUE)) & ((uint32)(MASK)))))
+
+/* Address of the register at OFFSET in the GPIO block starting at BASE */
+#define GPIO_REG(BASE, OFFSET)                 (((uint32)(BASE)) + ((uint32)(OFFSET)))
 
 /*******************************************************************************
- *                            PORTB Registers                                  *
+ *                            GPIO Register Offsets                            *
  *******************************************************************************/
-#define GPIO_PORTB_DATA_REG       (*((volatile uint32 *)0x400053FC))
-#define GPIO_PORTB_DIR_REG        (*((volatile uint32 *)0x40005400))
-#define GPIO_PORTB_AFSEL_REG      (*((volatile uint32 *)0x40005420))
-#define GPIO_PORTB_PUR_REG        (*((volatile uint32 *)0x40005510))
-#define GPIO_PORTB_PDR_REG        (*((volatile uint32 *)0x40005514))
-#define GPIO_PORTB_DEN_REG        (*((volatile uint32 *)0x4000551C))
-#define GPIO_PORTB_LOCK_REG       (*((volatile uint32 *)0x40005520))
-#define GPIO_PORTB_CR_REG         (*((volatile uint32 *)0x40005524))
-#define GPIO_PORTB_AMSEL_REG      (*((volatile uint32 *)0x40005528))
-#define GPIO_PORTB_PCTL_REG       (*((volatile uint32 *)0x4000552C))
+#define GPIO_DATA_REG_OFFSET       (0x3FCU)
+
+/* GPIODATA alias reaching only the pins of MASK */
+#define GPIO_DATA_MASKED_OFFSET(MASK)   (((uint32)(MASK)) << 2)
+
+#define GPIO_DIR_REG_OFFSET        (0x400U)
+#define GPIO_IS_REG_OFFSET         (0x404U)
+#define GPIO_IBE_REG_OFFSET        (0x408U)
+#define GPIO_IEV_REG_OFFSET        (0x40CU)
+#define GPIO_IM_REG_OFFSET         (0x410U)
+#define GPIO_RIS_REG_OFFSET        (0x414U)
+#define GPIO_MIS_REG_OFFSET        (0x418U)
+#define GPIO_ICR_REG_OFFSET        (0x41CU)
+#define GPIO_AFSEL_REG_OFFSET      (0x420U)
+#define GPIO_DR2R_REG_OFFSET       (0x500U)
+#define GPIO_DR4R_REG_OFFSET       (0x504U)
+#define GPIO_DR8R_REG_OFFSET       (0x508U)
+#define GPIO_ODR_REG_OFFSET        (0x50CU)
+#define GPIO_PUR_REG_OFFSET        (0x510U)
+#define GPIO_PDR_REG_OFFSET        (0x514U)
+#define GPIO_SLR_REG_OFFSET        (0x518U)
+#define GPIO_DEN_REG_OFFSET        (0x51CU)
+#define GPIO_LOCK_REG_OFFSET       (0x520U)
+#define GPIO_CR_REG_OFFSET         (0x524U)
+#define GPIO_AMSEL_REG_OFFSET      (0x528U)
+#define GPIO_PCTL_REG_OFFSET       (0x52CU)
+#define GPIO_ADCCTL_REG_OFFSET     (0x530U)
+#define GPIO_DMACTL_REG_OFFSET     (0x534U)
 
 /*******************************************************************************
- *                            PORTC Registers                                  *
+ *                            Device Descriptors                               *
  *******************************************************************************/
+/*
+ * Every device lists its ports in Port ID order as
+ * PORT(ARG, Port ID, Base Address, Number Of Pins, Locked Pins, Reserved Pins, Analog Pins)
+ */
+#if (PORT_DEVICE == PORT_DEVICE_TM4C123GH6PM)
 
-#define GPIO_PORTC_DATA_REG       (*((volatile uint32 *)0x400063FC))
-#define GPIO_PORTC_DIR_REG        (*((volatile uint32 *)0x40006400))
-#define GPIO_PORTC_AFSEL_REG      (*((volatile uint32 *)0x40006420))
-#define GPIO_PORTC_PUR_REG        (*((volatile uint32 *)0x40006510))
-#define GPIO_PORTC_PDR_REG        (*((volatile uint32 *)0x40006514))
-#define GPIO_PORTC_DEN_REG        (*((volatile uint32 *)0x4000651C))
-#define GPIO_PORTC_LOCK_REG       (*((volatile uint32 *)0x40006520))
-#define GPIO_PORTC_CR_REG         (*((volatile uint32 *)0x40006524))
-#define GPIO_PORTC_AMSEL_REG      (*((volatile uint32 *)0x40006528))
-#define GPIO_PORTC_PCTL_REG       (*((volatile uint32 *)0x4000652C))
+#define PORT_DEVICE_NUMBER_OF_PORTS           (6U)
 
-/*******************************************************************************
-*                            PORTD Registers                                  *
-*******************************************************************************/
-
-#define GPIO_PORTD_DATA_REG       (*((volatile uint32 *)0x400073FC))
-#define GPIO_PORTD_DIR_REG        (*((volatile uint32 *)0x40007400))
-#define GPIO_PORTD_AFSEL_REG      (*((volatile uint32 *)0x40007420))
-#define GPIO_PORTD_PUR_REG        (*((volatile uint32 *)0x40007510))
-#define GPIO_PORTD_PDR_REG        (*((volatile uint32 *)0x40007514))
-#define GPIO_PORTD_DEN_REG        (*((volatile uint32 *)0x4000751C))
-#define GPIO_PORTD_LOCK_REG       (*((volatile uint32 *)0x40007520))
-#define GPIO_PORTD_CR_REG         (*((volatile uint32 *)0x40007524))
-#define GPIO_PORTD_AMSEL_REG      (*((volatile uint32 *)0x40007528))
-#define GPIO_PORTD_PCTL_REG       (*((volatile uint32 *)0x4000752C))
+/* Legacy RCGC2 run mode clock gating register, one bit per port */
+#define PORT_CLOCK_GATING_REG_ADDRESS         (0x400FE108U)
 
-/*******************************************************************************
-*                            PORTE Registers                                  *
-*******************************************************************************/
-#define GPIO_PORTE_DATA_REG       (*((volatile uint32 *)0x400243FC))
-#define GPIO_PORTE_DIR_REG        (*((volatile uint32 *)0x40024400))
-#define GPIO_PORTE_AFSEL_REG      (*((volatile uint32 *)0x40024420))
-#define GPIO_PORTE_PUR_REG        (*((volatile uint32 *)0x40024510))
-#define GPIO_PORTE_PDR_REG        (*((volatile uint32 *)0x40024514))
-#define GPIO_PORTE_DEN_REG        (*((volatile uint32 *)0x4002451C))
-#define GPIO_PORTE_LOCK_REG       (*((volatile uint32 *)0x40024520))
-#define GPIO_PORTE_CR_REG         (*((volatile uint32 *)0x40024524))
-#define GPIO_PORTE_AMSEL_REG      (*((volatile uint32 *)0x40024528))
-#define GPIO_PORTE_PCTL_REG       (*((volatile uint32 *)0x4002452C))
+/* Ports on the APB aperture */
+#define GPIO_PORTA_BASE_ADDRESS               (0x40004000U)
+#define GPIO_PORTB_BASE_ADDRESS               (0x40005000U)
+#define GPIO_PORTC_BASE_ADDRESS               (0x40006000U)
+#define GPIO_PORTD_BASE_ADDRESS               (0x40007000U)
+#define GPIO_PORTE_BASE_ADDRESS               (0x40024000U)
+#define GPIO_PORTF_BASE_ADDRESS               (0x40025000U)
+
+/*
+ * PD7 and PF0 are the NMI pins, committed only after the unlock sequence.
+ * PC0-PC3 are the JTAG pins and stay committed to the debugger.
+ */
+#define PORT_DEVICE_PORT_LIST(PORT, ARG) \
+		PORT(ARG, 0U, GPIO_PORTA_BASE_ADDRESS , 8U , 0x00U , 0x00U , 0x00U) \
+		PORT(ARG, 1U, GPIO_PORTB_BASE_ADDRESS , 8U , 0x00U , 0x00U , 0x30U) \
+		PORT(ARG, 2U, GPIO_PORTC_BASE_ADDRESS , 8U , 0x00U , 0x0FU , 0xF0U) \
+		PORT(ARG, 3U, GPIO_PORTD_BASE_ADDRESS , 8U , 0x80U , 0x00U , 0x3FU) \
+		PORT(ARG, 4U, GPIO_PORTE_BASE_ADDRESS , 6U , 0x00U , 0x00U , 0x3FU) \
+		PORT(ARG, 5U, GPIO_PORTF_BASE_ADDRESS , 5U , 0x01U , 0x00U , 0x00U)
+
+#elif (PORT_DEVICE == PORT_DEVICE_TM4C1294NCPDT)
+
+#define PORT_DEVICE_NUMBER_OF_PORTS           (15U)
+
+/* RCGCGPIO run mode clock gating register, one bit per port */
+#define PORT_CLOCK_GATING_REG_ADDRESS         (0x400FE608U)
+
+/* Ports on the AHB aperture */
+#define GPIO_PORTA_BASE_ADDRESS               (0x40058000U)
+#define GPIO_PORTB_BASE_ADDRESS               (0x40059000U)
+#define GPIO_PORTC_BASE_ADDRESS               (0x4005A000U)
+#define GPIO_PORTD_BASE_ADDRESS               (0x4005B000U)
+#define GPIO_PORTE_BASE_ADDRESS               (0x4005C000U)
+#define GPIO_PORTF_BASE_ADDRESS               (0x4005D000U)
+#define GPIO_PORTG_BASE_ADDRESS               (0x4005E000U)
+#define GPIO_PORTH_BASE_ADDRESS               (0x4005F000U)
+#define GPIO_PORTJ_BASE_ADDRESS               (0x40060000U)
+#define GPIO_PORTK_BASE_ADDRESS               (0x40061000U)
+#define GPIO_PORTL_BASE_ADDRESS               (0x40062000U)
+#define GPIO_PORTM_BASE_ADDRESS               (0x40063000U)
+#define GPIO_PORTN_BASE_ADDRESS               (0x40064000U)
+#define GPIO_PORTP_BASE_ADDRESS               (0x40065000U)
+#define GPIO_PORTQ_BASE_ADDRESS               (0x40066000U)
+
+/*
+ * PD7 is the NMI pin, committed only after the unlock sequence.
+ * PC0-PC3 are the JTAG pins and stay committed to the debugger.
+ */
+#define PORT_DEVICE_PORT_LIST(PORT, ARG) \
+		PORT(ARG, 0U,  GPIO_PORTA_BASE_ADDRESS , 8U , 0x00U , 0x00U , 0x00U) \
+		PORT(ARG, 1U,  GPIO_PORTB_BASE_ADDRESS , 6U , 0x00U , 0x00U , 0x30U) \
+		PORT(ARG, 2U,  GPIO_PORTC_BASE_ADDRESS , 8U , 0x00U , 0x0FU , 0xF0U) \
+		PORT(ARG, 3U,  GPIO_PORTD_BASE_ADDRESS , 8U , 0x80U , 0x00U , 0xFFU) \
+		PORT(ARG, 4U,  GPIO_PORTE_BASE_ADDRESS , 6U , 0x00U , 0x00U , 0x3FU) \
+		PORT(ARG, 5U,  GPIO_PORTF_BASE_ADDRESS , 5U , 0x00U , 0x00U , 0x00U) \
+		PORT(ARG, 6U,  GPIO_PORTG_BASE_ADDRESS , 2U , 0x00U , 0x00U , 0x00U) \
+		PORT(ARG, 7U,  GPIO_PORTH_BASE_ADDRESS , 4U , 0x00U , 0x00U , 0x00U) \
+		PORT(ARG, 8U,  GPIO_PORTJ_BASE_ADDRESS , 2U , 0x00U , 0x00U , 0x00U) \
+		PORT(ARG, 9U,  GPIO_PORTK_BASE_ADDRESS , 8U , 0x00U , 0x00U , 0x0FU) \
+		PORT(ARG, 10U, GPIO_PORTL_BASE_ADDRESS , 8U , 0x00U , 0x00U , 0xC0U) \
+		PORT(ARG, 11U, GPIO_PORTM_BASE_ADDRESS , 8U , 0x00U , 0x00U , 0x00U) \
+		PORT(ARG, 12U, GPIO_PORTN_BASE_ADDRESS , 6U , 0x00U , 0x00U , 0x00U) \
+		PORT(ARG, 13U, GPIO_PORTP_BASE_ADDRESS , 6U , 0x00U , 0x00U , 0x00U) \
+		PORT(ARG, 14U, GPIO_PORTQ_BASE_ADDRESS , 5U , 0x00U , 0x00U , 0x00U)
+
+#elif (PORT_DEVICE == PORT_DEVICE_HOST_SCALE) && defined(PORT_HOST_BUILD)
+
+#define PORT_DEVICE_NUMBER_OF_PORTS           (18U)
+
+/* Same clock gating register as the TM4C129 devices */
+#define PORT_CLOCK_GATING_REG_ADDRESS         (0x400FE608U)
+
+/* Synthetic ports laid out back to back from this address */
+#define GPIO_PORT0_BASE_ADDRESS               (0x40100000U)
+#define GPIO_PORT_BASE_ADDRESS(PORT)          (GPIO_PORT0_BASE_ADDRESS + ((uint32)(PORT) * 0x1000U))
+
+#define PORT_DEVICE_SCALE_PORT(PORT, ARG, ID)   PORT(ARG, ID, GPIO_PORT_BASE_ADDRESS(ID) , 8U , 0x00U , 0x00U , 0x0FU)
+
+/* Port 3 mirrors the TM4C PD7 lock so the unlock path is exercised */
+#define PORT_DEVICE_PORT_LIST(PORT, ARG) \
+		PORT_DEVICE_SCALE_PORT(PORT, ARG, 0U)  PORT_DEVICE_SCALE_PORT(PORT, ARG, 1U)  PORT_DEVICE_SCALE_PORT(PORT, ARG, 2U) \
+		PORT(ARG, 3U, GPIO_PORT_BASE_ADDRESS(3U) , 8U , 0x80U , 0x00U , 0x0FU) \
+		PORT_DEVICE_SCALE_PORT(PORT, ARG, 4U)  PORT_DEVICE_SCALE_PORT(PORT, ARG, 5U)  PORT_DEVICE_SCALE_PORT(PORT, ARG, 6U) \
+		PORT_DEVICE_SCALE_PORT(PORT, ARG, 7U)  PORT_DEVICE_SCALE_PORT(PORT, ARG, 8U)  PORT_DEVICE_SCALE_PORT(PORT, ARG, 9U) \
+		PORT_DEVICE_SCALE_PORT(PORT, ARG, 10U) PORT_DEVICE_SCALE_PORT(PORT, ARG, 11U) PORT_DEVICE_SCALE_PORT(PORT, ARG, 12U) \
+		PORT_DEVICE_SCALE_PORT(PORT, ARG, 13U) PORT_DEVICE_SCALE_PORT(PORT, ARG, 14U) PORT_DEVICE_SCALE_PORT(PORT, ARG, 15U) \
+		PORT_DEVICE_SCALE_PORT(PORT, ARG, 16U) PORT_DEVICE_SCALE_PORT(PORT, ARG, 17U)
+
+#else
+#error "PORT_DEVICE does not select a supported Microcontroller"
+#endif
+
+/* Initializer of a Port_DeviceDescriptorType table indexed by the Port ID */
+#define PORT_DEVICE_DESCRIPTOR(ARG, ID, BASE, PINS, LOCKED, RESERVED, ANALOG)  {BASE , PINS , LOCKED , RESERVED , ANALOG},
+#define PORT_DEVICE_DESCRIPTORS    { PORT_DEVICE_PORT_LIST(PORT_DEVICE_DESCRIPTOR, 0U) }
+
+/* Constant expressions of one port of the device, used by the pre-compile configuration */
+#define PORT_DEVICE_BASE_OF(ARG, ID, BASE, PINS, LOCKED, RESERVED, ANALOG)     + (((ID) == (ARG)) ? ((uint32)(BASE)) : 0U)
+#define PORT_DEVICE_ANALOG_OF(ARG, ID, BASE, PINS, LOCKED, RESERVED, ANALOG)   | (((ID) == (ARG)) ? ((uint32)(ANALOG)) : 0U)
+
+#define PORT_DEVICE_BASE_ADDRESS(PORT)    (0U PORT_DEVICE_PORT_LIST(PORT_DEVICE_BASE_OF, (PORT)))
+#define PORT_DEVICE_ANALOG_PINS(PORT)     (0U PORT_DEVICE_PORT_LIST(PORT_DEVICE_ANALOG_OF, (PORT)))
+
+#if (PORT_NUMBER_OF_PORTS > PORT_DEVICE_NUMBER_OF_PORTS)
+#error "PORT_NUMBER_OF_PORTS exceeds the number of ports of the selected device"
+#endif
 
-/*******************************************************************************
-*                            PORTF Registers                                  *
-*******************************************************************************/
-#define GPIO_PORTF_DATA_REG       (*((volatile uint32 *)0x400253FC))
-#define GPIO_PORTF_DIR_REG        (*((volatile uint32 *)0x40025400))
-#define GPIO_PORTF_AFSEL_REG      (*((volatile uint32 *)0x40025420))
-#define GPIO_PORTF_PUR_REG        (*((volatile uint32 *)0x40025510))
-#define GPIO_PORTF_PDR_REG        (*((volatile uint32 *)0x40025514))
-#define GPIO_PORTF_DEN_REG        (*((volatile uint32 *)0x4002551C))
-#define GPIO_PORTF_LOCK_REG       (*((volatile uint32 *)0x40025520))
-#define GPIO_PORTF_CR_REG         (*((volatile uint32 *)0x40025524))
-#define GPIO_PORTF_AMSEL_REG      (*((volatile uint32 *)0x40025528))
-#define GPIO_PORTF_PCTL_REG       (*((volatile uint32 *)0x4002552C))
-
-#define SYSCTL_REGCGC2_REG        (*((volatile uint32 *)0x400FE108))
 #endif /* PORT_REGS_H_ */
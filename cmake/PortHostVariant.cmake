@@ -0,0 +1,53 @@
+# port_add_host_variant(<name>
+#                       [CONFIG_DIR <dir>]
+#                       [OVERRIDES <OPTION>=<VALUE> ...])
+#
+# Builds the Port driver as the host library <name> with a configuration that
+# differs from the one in the source tree. The driver sources are copied to
+# the build tree so the variant's Port_Cfg.h is the one found next to Port.h:
+#   CONFIG_DIR  - directory whose Port_Cfg.h / Port_PBcfg.c replace the
+#                 files of the source tree
+#   OVERRIDES   - pre-compile options of Port_Cfg.h given a new value
+function(port_add_host_variant NAME)
+
+  cmake_parse_arguments(VARIANT "" "CONFIG_DIR" "OVERRIDES" ${ARGN})
+
+  set(VARIANT_DIR ${CMAKE_BINARY_DIR}/variants/${NAME})
+
+  foreach(FILE Port.c Port.h Port_Regs.h Port_Cfg.h Port_PBcfg.c)
+    if(VARIANT_CONFIG_DIR AND EXISTS ${VARIANT_CONFIG_DIR}/${FILE})
+      set(SOURCE ${VARIANT_CONFIG_DIR}/${FILE})
+    else()
+      set(SOURCE ${PROJECT_SOURCE_DIR}/${FILE})
+    endif()
+    configure_file(${SOURCE} ${VARIANT_DIR}/${FILE} COPYONLY)
+  endforeach()
+
+  if(VARIANT_OVERRIDES)
+    file(READ ${VARIANT_DIR}/Port_Cfg.h CONFIG)
+    foreach(OVERRIDE ${VARIANT_OVERRIDES})
+      string(REGEX MATCH "^([^=]+)=(.*)$" MATCHED "${OVERRIDE}")
+      if(NOT MATCHED)
+        message(FATAL_ERROR "port_add_host_variant: bad override '${OVERRIDE}'")
+      endif()
+      set(OPTION ${CMAKE_MATCH_1})
+      set(VALUE ${CMAKE_MATCH_2})
+      string(REGEX REPLACE "#define[ \t]+${OPTION}[ \t][^\n]*" "#define ${OPTION} (${VALUE})" CONFIG "${CONFIG}")
+    endforeach()
+    # Only touch the copy when it changes, to keep incremental builds
+    file(WRITE ${VARIANT_DIR}/Port_Cfg.h.new "${CONFIG}")
+    configure_file(${VARIANT_DIR}/Port_Cfg.h.new ${VARIANT_DIR}/Port_Cfg.h COPYONLY)
+  endif()
+
+  add_library(${NAME} STATIC
+      ${VARIANT_DIR}/Port.c
+      ${VARIANT_DIR}/Port_PBcfg.c
+      ${PROJECT_SOURCE_DIR}/host/Det.c
+      ${PROJECT_SOURCE_DIR}/host/Port_Sim.c)
+  target_include_directories(${NAME} PUBLIC
+      ${VARIANT_DIR}
+      ${PROJECT_SOURCE_DIR}/stubs
+      ${PROJECT_SOURCE_DIR}/host)
+  target_compile_definitions(${NAME} PUBLIC PORT_HOST_BUILD)
+
+endfunction()
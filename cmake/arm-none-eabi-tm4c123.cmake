@@ -0,0 +1,20 @@
+# Cross target definition for the TM4C123GH6PM (ARM Cortex-M4F)
+#
+#   cmake -S . -B build-tm4c123 -DCMAKE_TOOLCHAIN_FILE=cmake/arm-none-eabi-tm4c123.cmake \
+#         -DPORT_AUTOSAR_INCLUDE_DIRS=<ECU project directories of Std_Types.h, Det.h, ...>
+
+set(CMAKE_SYSTEM_NAME Generic)
+set(CMAKE_SYSTEM_PROCESSOR arm)
+
+set(CMAKE_C_COMPILER arm-none-eabi-gcc)
+set(CMAKE_AR arm-none-eabi-ar)
+set(CMAKE_RANLIB arm-none-eabi-ranlib)
+
+# No C library or startup code for the compiler checks
+set(CMAKE_TRY_COMPILE_TARGET_TYPE STATIC_LIBRARY)
+
+set(CMAKE_C_FLAGS_INIT "-mcpu=cortex-m4 -mthumb -mfloat-abi=hard -mfpu=fpv4-sp-d16 -ffunction-sections -fdata-sections")
+
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
@@ -0,0 +1,81 @@
+/******************************************************************************
+ *
+ * Module: Det
+ *
+ * File Name: Det.c
+ *
+ * Description: Recording Det stub used by the host build. Every reported
+ *              development error is counted and the first
+ *              DET_MAX_RECORDED_ERRORS reports are kept for inspection.
+ *
+ * Author: Hussam Wael
+ ******************************************************************************/
+
+#include "Det.h"
+
+STATIC Det_ErrorType Det_Errors[DET_MAX_RECORDED_ERRORS];
+STATIC uint32 Det_NumberOfReports = 0;
+
+/************************************************************************************
+ * Service Name: Det_ReportError
+ * Service ID[hex]: 0x01
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): ModuleId - Module Id of calling module.
+ *                  InstanceId - The identifier of the index based instance of a module.
+ *                  ApiId - Id of API service in which error is detected.
+ *                  ErrorId - ID of detected development error.
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Std_ReturnType - always returns E_OK.
+ * Description: Service to report development errors.
+ ************************************************************************************/
+Std_ReturnType Det_ReportError( uint16 ModuleId,
+                                uint8 InstanceId,
+                                uint8 ApiId,
+                                uint8 ErrorId )
+{
+	if(Det_NumberOfReports < DET_MAX_RECORDED_ERRORS){
+
+		Det_Errors[Det_NumberOfReports].ModuleId = ModuleId;
+		Det_Errors[Det_NumberOfReports].InstanceId = InstanceId;
+		Det_Errors[Det_NumberOfReports].ApiId = ApiId;
+		Det_Errors[Det_NumberOfReports].ErrorId = ErrorId;
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	Det_NumberOfReports++;
+
+	return E_OK;
+}
+
+uint32 Det_GetNumberOfReports(void)
+{
+	return Det_NumberOfReports;
+}
+
+Std_ReturnType Det_GetReport(uint32 Index, Det_ErrorType * Error)
+{
+	Std_ReturnType Result = E_NOT_OK;
+
+	if((NULL_PTR != Error) && (Index < Det_NumberOfReports) && (Index < DET_MAX_RECORDED_ERRORS)){
+
+		*Error = Det_Errors[Index];
+
+		Result = E_OK;
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	return Result;
+}
+
+void Det_ClearErrors(void)
+{
+	Det_NumberOfReports = 0;
+}
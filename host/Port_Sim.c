@@ -0,0 +1,370 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Sim.c
+ *
+ * Description: Simulated register file used by the host build of the Port Driver.
+ *              Every 4KB peripheral window touched by the driver is backed by
+ *              plain memory, created on first access. The GPIO windows of the
+ *              selected device model the behaviour the driver relies on:
+ *              - the address masked GPIODATA aperture
+ *              - GPIOLOCK / GPIOCR gating the commit protected registers
+ *              - GPIOPUR / GPIOPDR clearing each other
+ *              - GPIODR2R / GPIODR4R / GPIODR8R clearing each other
+ *              - GPIOICR clearing the latched interrupts of GPIORIS
+ *
+ * Author: Hussam Wael
+ ******************************************************************************/
+
+#include "Port.h"
+#include "Port_Regs.h"
+
+typedef struct
+{
+	uint32 BaseAddress;
+
+	/* Descriptor of the GPIO port behind this window, NULL_PTR for other peripherals */
+	const Port_DeviceDescriptorType * Gpio;
+
+	boolean Unlocked;
+
+	uint32 Registers[PORT_SIM_BLOCK_SIZE];
+
+}Port_SimBlockType;
+
+STATIC const Port_DeviceDescriptorType Port_SimDevice[PORT_DEVICE_NUMBER_OF_PORTS] = PORT_DEVICE_DESCRIPTORS;
+
+STATIC Port_SimBlockType Port_SimBlocks[PORT_SIM_MAX_BLOCKS];
+STATIC uint32 Port_SimNumberOfBlocks = 0;
+STATIC Port_SimBlockType * Port_SimLastBlock = NULL_PTR;
+
+STATIC uint32 Port_SimReads = 0;
+STATIC uint32 Port_SimWrites = 0;
+STATIC uint32 Port_SimCycles = 0;
+STATIC uint8 Port_SimApplicationId = 0;
+STATIC uint32 Port_SimExclusiveAreaDepth = 0;
+
+#define PORT_SIM_REG(BLOCK, OFFSET)   ((BLOCK)->Registers[(OFFSET) / 4U])
+
+/* Reset state of a GPIO window, the reserved (JTAG) pins come up in their alternate function */
+STATIC void Port_SimResetGpio(Port_SimBlockType * Block)
+{
+	uint32 Reserved = Block->Gpio->ReservedPins;
+	uint32 Pctl = 0;
+
+	for(uint32 Pin = 0 ; Pin < 8U ; Pin++){
+
+		if(Reserved & (((uint32)1) << Pin)){
+
+			Pctl |= ((uint32)1) << (4U * Pin);
+		}
+
+		else{
+			/* No Action Required */
+		}
+	}
+
+	PORT_SIM_REG(Block, GPIO_CR_REG_OFFSET) = 0xFFU & ~(Block->Gpio->LockedPins | Reserved);
+	PORT_SIM_REG(Block, GPIO_AFSEL_REG_OFFSET) = Reserved;
+	PORT_SIM_REG(Block, GPIO_PUR_REG_OFFSET) = Reserved;
+	PORT_SIM_REG(Block, GPIO_DEN_REG_OFFSET) = Reserved;
+	PORT_SIM_REG(Block, GPIO_PCTL_REG_OFFSET) = Pctl;
+	PORT_SIM_REG(Block, GPIO_DR2R_REG_OFFSET) = 0xFFU;
+	Block->Unlocked = FALSE;
+}
+
+STATIC Port_SimBlockType * Port_SimFindBlock(uint32 Address)
+{
+	uint32 BaseAddress = Address & ~((uint32)0xFFFU);
+	Port_SimBlockType * Block = NULL_PTR;
+
+	if((NULL_PTR != Port_SimLastBlock) && (Port_SimLastBlock->BaseAddress == BaseAddress)){
+
+		Block = Port_SimLastBlock;
+	}
+
+	else{
+
+		for(uint32 i = 0 ; i < Port_SimNumberOfBlocks ; i++){
+
+			if(Port_SimBlocks[i].BaseAddress == BaseAddress){
+
+				Block = &Port_SimBlocks[i];
+				break;
+			}
+
+			else{
+				/* No Action Required */
+			}
+		}
+	}
+
+	if(NULL_PTR == Block){
+
+		/* Running out of windows is a host set-up error, not a driver error */
+		if(Port_SimNumberOfBlocks >= PORT_SIM_MAX_BLOCKS){
+
+			Port_SimNumberOfBlocks = PORT_SIM_MAX_BLOCKS - 1U;
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		Block = &Port_SimBlocks[Port_SimNumberOfBlocks];
+		Port_SimNumberOfBlocks++;
+
+		Block->BaseAddress = BaseAddress;
+		Block->Gpio = NULL_PTR;
+
+		for(uint32 i = 0 ; i < PORT_SIM_BLOCK_SIZE ; i++){
+
+			Block->Registers[i] = 0;
+		}
+
+		for(uint32 Port = 0 ; Port < PORT_DEVICE_NUMBER_OF_PORTS ; Port++){
+
+			if(Port_SimDevice[Port].BaseAddress == BaseAddress){
+
+				Block->Gpio = &Port_SimDevice[Port];
+
+				Port_SimResetGpio(Block);
+			}
+
+			else{
+				/* No Action Required */
+			}
+		}
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	Port_SimLastBlock = Block;
+
+	return Block;
+}
+
+uint32 Port_SimRead(uint32 Address)
+{
+	Port_SimBlockType * Block = Port_SimFindBlock(Address);
+	uint32 Offset = Address & 0xFFFU;
+	uint32 Value;
+
+	Port_SimReads++;
+	Port_SimCycles++;
+
+	if((NULL_PTR != Block->Gpio) && (Offset <= GPIO_DATA_REG_OFFSET)){
+
+		/* Address bits 9:2 select the GPIODATA bits that are read */
+		Value = PORT_SIM_REG(Block, GPIO_DATA_REG_OFFSET) & (Offset >> 2);
+	}
+
+	else if((NULL_PTR != Block->Gpio) && (Offset == GPIO_LOCK_REG_OFFSET)){
+
+		Value = (TRUE == Block->Unlocked) ? 0U : 1U;
+	}
+
+	else if((NULL_PTR != Block->Gpio) && (Offset == GPIO_MIS_REG_OFFSET)){
+
+		Value = PORT_SIM_REG(Block, GPIO_RIS_REG_OFFSET) & PORT_SIM_REG(Block, GPIO_IM_REG_OFFSET);
+	}
+
+	else{
+
+		Value = Block->Registers[Offset / 4U];
+	}
+
+	return Value;
+}
+
+void Port_SimWrite(uint32 Address, uint32 Value)
+{
+	Port_SimBlockType * Block = Port_SimFindBlock(Address);
+	uint32 Offset = Address & 0xFFFU;
+
+	Port_SimWrites++;
+	Port_SimCycles++;
+
+	if(NULL_PTR == Block->Gpio){
+
+		Block->Registers[Offset / 4U] = Value;
+	}
+
+	else if(Offset <= GPIO_DATA_REG_OFFSET){
+
+		/* Address bits 9:2 select the GPIODATA bits that are written */
+		uint32 Mask = Offset >> 2;
+
+		PORT_SIM_REG(Block, GPIO_DATA_REG_OFFSET) = (PORT_SIM_REG(Block, GPIO_DATA_REG_OFFSET) & ~Mask) | (Value & Mask);
+	}
+
+	else{
+
+		uint32 Commit = PORT_SIM_REG(Block, GPIO_CR_REG_OFFSET);
+		uint32 Old = Block->Registers[Offset / 4U];
+
+		switch(Offset){
+
+		case GPIO_LOCK_REG_OFFSET:
+
+			Block->Unlocked = (UNLOCKING_VALUE == Value) ? TRUE : FALSE;
+			break;
+
+		case GPIO_CR_REG_OFFSET:
+
+			if(TRUE == Block->Unlocked){
+
+				PORT_SIM_REG(Block, GPIO_CR_REG_OFFSET) = Value & 0xFFU;
+			}
+
+			else{
+				/* No Action Required */
+			}
+			break;
+
+		case GPIO_AFSEL_REG_OFFSET:
+		case GPIO_DEN_REG_OFFSET:
+
+			Block->Registers[Offset / 4U] = (Old & ~Commit) | (Value & Commit);
+			break;
+
+		case GPIO_PUR_REG_OFFSET:
+
+			PORT_SIM_REG(Block, GPIO_PUR_REG_OFFSET) = (Old & ~Commit) | (Value & Commit);
+			PORT_SIM_REG(Block, GPIO_PDR_REG_OFFSET) &= ~(Value & Commit);
+			break;
+
+		case GPIO_PDR_REG_OFFSET:
+
+			PORT_SIM_REG(Block, GPIO_PDR_REG_OFFSET) = (Old & ~Commit) | (Value & Commit);
+			PORT_SIM_REG(Block, GPIO_PUR_REG_OFFSET) &= ~(Value & Commit);
+			break;
+
+		case GPIO_DR2R_REG_OFFSET:
+		case GPIO_DR4R_REG_OFFSET:
+		case GPIO_DR8R_REG_OFFSET:
+
+			/* Selecting a drive strength deselects the other two */
+			PORT_SIM_REG(Block, GPIO_DR2R_REG_OFFSET) &= ~Value;
+			PORT_SIM_REG(Block, GPIO_DR4R_REG_OFFSET) &= ~Value;
+			PORT_SIM_REG(Block, GPIO_DR8R_REG_OFFSET) &= ~Value;
+			Block->Registers[Offset / 4U] = Value;
+			break;
+
+		case GPIO_RIS_REG_OFFSET:
+		case GPIO_MIS_REG_OFFSET:
+
+			/* Read only */
+			break;
+
+		case GPIO_ICR_REG_OFFSET:
+
+			PORT_SIM_REG(Block, GPIO_RIS_REG_OFFSET) &= ~Value;
+			break;
+
+		default:
+
+			Block->Registers[Offset / 4U] = Value;
+		}
+	}
+}
+
+uint32 Port_SimPeek(uint32 Address)
+{
+	Port_SimBlockType * Block = Port_SimFindBlock(Address);
+	uint32 Offset = Address & 0xFFFU;
+
+	if((NULL_PTR != Block->Gpio) && (Offset <= GPIO_DATA_REG_OFFSET)){
+
+		Offset = GPIO_DATA_REG_OFFSET;
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	return Block->Registers[Offset / 4U];
+}
+
+void Port_SimPoke(uint32 Address, uint32 Value)
+{
+	Port_SimBlockType * Block = Port_SimFindBlock(Address);
+	uint32 Offset = Address & 0xFFFU;
+
+	if((NULL_PTR != Block->Gpio) && (Offset <= GPIO_DATA_REG_OFFSET)){
+
+		Offset = GPIO_DATA_REG_OFFSET;
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	Block->Registers[Offset / 4U] = Value;
+}
+
+void Port_SimReset(void)
+{
+	Port_SimNumberOfBlocks = 0;
+	Port_SimLastBlock = NULL_PTR;
+
+	/* Create the GPIO windows up front so no access pays for it later */
+	for(uint32 Port = 0 ; Port < PORT_DEVICE_NUMBER_OF_PORTS ; Port++){
+
+		(void)Port_SimFindBlock(Port_SimDevice[Port].BaseAddress);
+	}
+
+	Port_SimApplicationId = 0;
+	Port_SimExclusiveAreaDepth = 0;
+
+	Port_SimClearCounters();
+}
+
+uint32 Port_SimGetReadCount(void)
+{
+	return Port_SimReads;
+}
+
+uint32 Port_SimGetWriteCount(void)
+{
+	return Port_SimWrites;
+}
+
+void Port_SimClearCounters(void)
+{
+	Port_SimReads = 0;
+	Port_SimWrites = 0;
+}
+
+uint32 Port_SimGetCycleCount(void)
+{
+	return Port_SimCycles;
+}
+
+void Port_SimSetApplicationId(uint8 ApplicationId)
+{
+	Port_SimApplicationId = ApplicationId;
+}
+
+uint8 Port_SimGetApplicationId(void)
+{
+	return Port_SimApplicationId;
+}
+
+void Port_SimEnterExclusiveArea(void)
+{
+	Port_SimExclusiveAreaDepth++;
+}
+
+void Port_SimExitExclusiveArea(void)
+{
+	Port_SimExclusiveAreaDepth--;
+}
+
+uint32 Port_SimGetExclusiveAreaDepth(void)
+{
+	return Port_SimExclusiveAreaDepth;
+}
@@ -0,0 +1,51 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Sim.h
+ *
+ * Description: Simulated register file used by the host build of the Port Driver
+ *
+ * Author: Hussam Wael
+ ******************************************************************************/
+
+#ifndef PORT_SIM_H_
+#define PORT_SIM_H_
+
+#include "Std_Types.h"
+
+/* Number of 4KB peripheral windows the simulated register file can hold */
+#define PORT_SIM_MAX_BLOCKS          (32U)
+
+/* Size of one peripheral window in 32-bit registers */
+#define PORT_SIM_BLOCK_SIZE          (0x1000U / 4U)
+
+/* Register access as seen by the driver, counted and with GPIO side effects */
+uint32 Port_SimRead(uint32 Address);
+void Port_SimWrite(uint32 Address, uint32 Value);
+
+/* Raw access to the register storage, not counted and without side effects */
+uint32 Port_SimPeek(uint32 Address);
+void Port_SimPoke(uint32 Address, uint32 Value);
+
+/* Puts every simulated register back to its reset value and clears the counters */
+void Port_SimReset(void);
+
+/* Number of register reads and writes done by the driver */
+uint32 Port_SimGetReadCount(void);
+uint32 Port_SimGetWriteCount(void);
+void Port_SimClearCounters(void);
+
+/* Free running count of the register accesses, standing in for the cycle counter of the target */
+uint32 Port_SimGetCycleCount(void);
+
+/* OS-Application the driver sees as its caller, 0 after Port_SimReset */
+void Port_SimSetApplicationId(uint8 ApplicationId);
+uint8 Port_SimGetApplicationId(void);
+
+/* Exclusive area of the driver, the host only counts how deep it is entered */
+void Port_SimEnterExclusiveArea(void);
+void Port_SimExitExclusiveArea(void);
+uint32 Port_SimGetExclusiveAreaDepth(void);
+
+#endif /* PORT_SIM_H_ */
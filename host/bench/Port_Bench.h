@@ -0,0 +1,42 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Bench.h
+ *
+ * Description: Timing helpers shared by the host benchmarks of the Port Driver
+ *
+ * Author: Hussam Wael
+ ******************************************************************************/
+
+#ifndef PORT_BENCH_H_
+#define PORT_BENCH_H_
+
+#include <time.h>
+
+#include "Std_Types.h"
+
+/* Monotonic time stamp in nanoseconds */
+static inline uint64 Port_BenchNow(void)
+{
+	struct timespec Now;
+
+	clock_gettime(CLOCK_MONOTONIC, &Now);
+
+	return ((uint64)Now.tv_sec * 1000000000ULL) + (uint64)Now.tv_nsec;
+}
+
+/* Result of timing one service on the simulated register file */
+typedef struct
+{
+	/* Fastest and mean duration of one call in nanoseconds */
+	float64 MinNs;
+	float64 MeanNs;
+
+	/* Register accesses of one call */
+	uint32 Reads;
+	uint32 Writes;
+
+}Port_BenchResultType;
+
+#endif /* PORT_BENCH_H_ */
@@ -0,0 +1,344 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_ScaleBench.c
+ *
+ * Description: Host benchmark of the Port Driver services. Built against the
+ *              TM4C123GH6PM configuration in the post-build and the pre-compile
+ *              variants, and against the 140 pin PORT_DEVICE_HOST_SCALE
+ *              configuration.
+ *
+ * Author: Hussam Wael
+ ******************************************************************************/
+
+#include <stdio.h>
+
+#include "Port.h"
+#include "Port_Regs.h"
+#include "Port_Sim.h"
+#include "Port_Bench.h"
+#include "Det.h"
+
+#define PORT_BENCH_ITERATIONS      (20000U)
+
+typedef void (*Port_BenchServiceType)(void);
+
+#if (PORT_CONFIG_VARIANT == PORT_VARIANT_PRE_COMPILE)
+
+/* The pre-compile variant has no configuration table, the benchmark keeps its own copy of the configuration */
+#define PORT_BENCH_PIN(ARG, PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO) \
+		{PORT, PIN, MODE, LEVEL, DIR, RES, CHM, CHD, IRQ, DRV, SLEW, OUT, TRIG, PRIO},
+#define PORT_BENCH_GROUP(ARG, PORT, PINS)    {PORT, PINS},
+
+STATIC const Port_ConfigType Port_BenchConfig = {
+		.Pins = { PORT_PRECOMPILE_PINS(PORT_BENCH_PIN, 0U) },
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+		.Groups = { PORT_PRECOMPILE_GROUPS(PORT_BENCH_GROUP, 0U) },
+#endif
+#if (PORT_MODE_PROFILE_API == STD_ON)
+		.Profiles = PORT_PRECOMPILE_PROFILE_TABLE,
+#endif
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+		.Partitions = PORT_PRECOMPILE_PARTITION_TABLE,
+#endif
+};
+
+#define PORT_BENCH_INIT_CONFIG        (NULL_PTR)
+#define PORT_BENCH_VARIANT            "pre-compile"
+
+#else
+
+#define Port_BenchConfig              Port_Configuration
+#define PORT_BENCH_INIT_CONFIG        (&Port_Configuration)
+#define PORT_BENCH_VARIANT            "post-build"
+
+#endif
+
+#if (PORT_EVENT_LOG == STD_ON)
+#define PORT_BENCH_OPTIONS            ", event log"
+#elif (PORT_PIN_OWNERSHIP == STD_ON)
+#define PORT_BENCH_OPTIONS            ", pin ownership"
+#elif (PORT_ERROR_MONITOR == STD_ON)
+#define PORT_BENCH_OPTIONS            ", error monitor"
+#else
+#define PORT_BENCH_OPTIONS            ""
+#endif
+
+STATIC Port_PinType Port_BenchDirectionPin;
+STATIC Port_PinType Port_BenchModePin;
+
+#if (PORT_CONTEXT_API == STD_ON)
+STATIC Port_ContextType Port_BenchContext;
+#endif
+
+STATIC void Port_BenchInit(void)
+{
+	Port_Init(PORT_BENCH_INIT_CONFIG);
+}
+
+#if (PORT_DEFERRED_INIT == STD_ON)
+STATIC void Port_BenchCompleteInit(void)
+{
+	Port_CompleteInit();
+}
+
+STATIC void Port_BenchMainFunction(void)
+{
+	Port_MainFunction();
+}
+#endif
+
+STATIC void Port_BenchRefresh(void)
+{
+	Port_RefreshPortDirection();
+}
+
+STATIC void Port_BenchSetPinDirection(void)
+{
+	Port_SetPinDirection(Port_BenchDirectionPin, PORT_PIN_OUT);
+}
+
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+STATIC void Port_BenchSetGroupDirection(void)
+{
+	Port_SetGroupDirection(0U, PORT_PIN_OUT);
+}
+#endif
+
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+STATIC void Port_BenchSetPinsDirection(void)
+{
+	const Port_ConfigPin * Pin = &Port_BenchConfig.Pins[Port_BenchDirectionPin];
+
+	Port_SetPinsDirection(Pin->Port_Num, (Port_PinMaskType)(1U << Pin->Pin_Num), (Port_PinMaskType)(1U << Pin->Pin_Num));
+}
+#endif
+
+#if (PORT_MODE_PROFILE_API == STD_ON)
+/* Alternates between the first two profiles, the switch of a sensing loop */
+STATIC void Port_BenchSetModeProfile(void)
+{
+	STATIC Port_ProfileType Profile = 0U;
+
+	Profile = (Port_ProfileType)((0U == Profile) ? 1U : 0U);
+
+	Port_SetModeProfile(Profile);
+}
+#endif
+
+STATIC void Port_BenchSetPinMode(void)
+{
+	Port_SetPinMode(Port_BenchModePin, PORT_MODE_DIO);
+}
+
+/* Error path: a pin out of range with a mode out of range, rejected with a single Det report */
+STATIC void Port_BenchSetPinModeError(void)
+{
+	Port_SetPinMode(PORT_NUMBER_OF_PORT_PINS, (Port_PinModeType)(PORT_MODE_ADC + 1U));
+}
+
+#if (PORT_CONTEXT_API == STD_ON)
+STATIC void Port_BenchRestoreContext(void)
+{
+	Port_RestoreContext(&Port_BenchContext);
+}
+#endif
+
+/*
+ * Time a service, Port_Init and Port_RestoreContext run on a freshly reset register file every iteration.
+ * Prepare, if any, runs untimed before every call.
+ */
+STATIC Port_BenchResultType Port_BenchRun(Port_BenchServiceType Service, boolean ResetBeforeCall, Port_BenchServiceType Prepare)
+{
+	Port_BenchResultType Result = {0};
+	float64 Total = 0;
+
+	for(uint32 i = 0 ; i < PORT_BENCH_ITERATIONS ; i++){
+
+		uint64 Start;
+		float64 Duration;
+
+		if(TRUE == ResetBeforeCall){
+
+			Port_SimReset();
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		if(NULL_PTR != Prepare){
+
+			Prepare();
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		Port_SimClearCounters();
+
+		Start = Port_BenchNow();
+		Service();
+		Duration = (float64)(Port_BenchNow() - Start);
+
+		Total += Duration;
+
+		if((0U == i) || (Duration < Result.MinNs)){
+
+			Result.MinNs = Duration;
+		}
+
+		else{
+			/* No Action Required */
+		}
+	}
+
+	Result.MeanNs = Total / PORT_BENCH_ITERATIONS;
+	Result.Reads = Port_SimGetReadCount();
+	Result.Writes = Port_SimGetWriteCount();
+
+	return Result;
+}
+
+STATIC void Port_BenchPrint(const char * Name, Port_BenchResultType Result)
+{
+	printf("%-26s %8u %8u %10.1f %10.1f\n", Name, Result.Reads, Result.Writes, Result.MinNs, Result.MeanNs);
+}
+
+int main(void)
+{
+	Port_BenchDirectionPin = PORT_NUMBER_OF_PORT_PINS;
+	Port_BenchModePin = PORT_NUMBER_OF_PORT_PINS;
+
+	for(Port_PinType i = 0 ; i < PORT_NUMBER_OF_PORT_PINS ; i++){
+
+		if((PORT_NUMBER_OF_PORT_PINS == Port_BenchDirectionPin)
+				&& (PORT_PIN_DIRECTION_CHANGEABLE == Port_BenchConfig.Pins[i].changeableDirection)){
+
+			Port_BenchDirectionPin = i;
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		if((PORT_NUMBER_OF_PORT_PINS == Port_BenchModePin)
+				&& (PORT_PIN_MODE_CHANGEABLE == Port_BenchConfig.Pins[i].changeableMode)){
+
+			Port_BenchModePin = i;
+		}
+
+		else{
+			/* No Action Required */
+		}
+	}
+
+	printf("Port driver host benchmark: %u pins on %u ports, %s%s, %u iterations\n",
+			(unsigned)PORT_NUMBER_OF_PORT_PINS, (unsigned)PORT_NUMBER_OF_PORTS, PORT_BENCH_VARIANT, PORT_BENCH_OPTIONS, PORT_BENCH_ITERATIONS);
+	printf("%-26s %8s %8s %10s %10s\n", "Service", "Reads", "Writes", "Min [ns]", "Mean [ns]");
+
+#if (PORT_DEFERRED_INIT == STD_ON)
+	/* Time to safe state: Port_Init only programs the critical pins */
+	Port_BenchPrint("Port_Init (critical)", Port_BenchRun(Port_BenchInit, TRUE, NULL_PTR));
+	Port_BenchPrint("Port_MainFunction (first)", Port_BenchRun(Port_BenchMainFunction, TRUE, Port_BenchInit));
+	/* Leaves the driver initialized for the services below */
+	Port_BenchPrint("Port_CompleteInit", Port_BenchRun(Port_BenchCompleteInit, TRUE, Port_BenchInit));
+#else
+	Port_BenchPrint("Port_Init", Port_BenchRun(Port_BenchInit, TRUE, NULL_PTR));
+#endif
+#if (PORT_WARM_RESET_CHECK == STD_ON)
+	/* Warm reset: the registers still hold the images Port_Init programmed before */
+	Port_BenchPrint("Port_Init (warm reset)", Port_BenchRun(Port_BenchInit, TRUE, Port_BenchInit));
+#endif
+#if (PORT_INIT_VERIFICATION == STD_ON)
+	printf("%-26s failing ports 0x%X\n", "Port_Init verification", (unsigned)Port_GetVerificationResult());
+#endif
+#if (PORT_CONTEXT_API == STD_ON)
+	Port_SaveContext(&Port_BenchContext);
+	Port_BenchPrint("Port_RestoreContext", Port_BenchRun(Port_BenchRestoreContext, TRUE, NULL_PTR));
+#endif
+
+	Port_BenchPrint("Port_RefreshPortDirection", Port_BenchRun(Port_BenchRefresh, FALSE, NULL_PTR));
+
+	if(Port_BenchDirectionPin < PORT_NUMBER_OF_PORT_PINS){
+
+		Port_BenchPrint("Port_SetPinDirection", Port_BenchRun(Port_BenchSetPinDirection, FALSE, NULL_PTR));
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+		Port_BenchPrint("Port_SetPinsDirection", Port_BenchRun(Port_BenchSetPinsDirection, FALSE, NULL_PTR));
+#endif
+	}
+
+	else{
+
+		printf("%-26s no direction changeable pin configured\n", "Port_SetPinDirection");
+	}
+
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+	Port_BenchPrint("Port_SetGroupDirection", Port_BenchRun(Port_BenchSetGroupDirection, FALSE, NULL_PTR));
+#endif
+
+	if(Port_BenchModePin < PORT_NUMBER_OF_PORT_PINS){
+
+		Port_BenchPrint("Port_SetPinMode", Port_BenchRun(Port_BenchSetPinMode, FALSE, NULL_PTR));
+	}
+
+	else{
+
+		printf("%-26s no mode changeable pin configured\n", "Port_SetPinMode");
+	}
+
+	Det_ClearErrors();
+	Port_BenchPrint("Port_SetPinMode (error)", Port_BenchRun(Port_BenchSetPinModeError, FALSE, NULL_PTR));
+	printf("%-26s %u Det reports for %u calls\n", "", Det_GetNumberOfReports(), PORT_BENCH_ITERATIONS);
+#if (PORT_ERROR_MONITOR == STD_ON)
+	{
+		Port_ErrorStatusType Status;
+
+		if(E_OK == Port_GetErrorStatus(PORT_SET_PIN_MODE_SID, &Status)){
+
+			printf("%-26s errors 0x%X, %u detected, %u held back from Det\n", "",
+					(unsigned)Status.Errors, Status.Detected, Status.Suppressed);
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		Port_ResetErrorCounters();
+	}
+#endif
+
+#if (PORT_MODE_PROFILE_API == STD_ON)
+	if(PORT_NUMBER_OF_MODE_PROFILES >= 2U){
+
+		Port_BenchPrint("Port_SetModeProfile", Port_BenchRun(Port_BenchSetModeProfile, FALSE, NULL_PTR));
+	}
+
+	else{
+
+		printf("%-26s less than two mode profiles configured\n", "Port_SetModeProfile");
+	}
+#endif
+
+#if (PORT_EVENT_LOG == STD_ON)
+	{
+		Port_EventType Event;
+		uint32 Count = Port_GetEventCount();
+
+		if((0U != Count) && (E_OK == Port_GetEvent(Count - 1U, &Event))){
+
+			printf("%-26s %u records, last: service 0x%02X pin %u %u -> %u at %u\n", "Event log", Count,
+					Event.ServiceId, Event.Pin, Event.OldValue, Event.NewValue, Event.Timestamp);
+		}
+
+		else{
+
+			printf("%-26s %u records\n", "Event log", Count);
+		}
+	}
+#endif
+
+	return 0;
+}
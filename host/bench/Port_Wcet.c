@@ -0,0 +1,482 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Wcet.c
+ *
+ * Description: Worst case access bound report of the Port Driver services.
+ *              Every service is called with every argument of the linked
+ *              configuration, valid or not, on the simulated register file.
+ *              The maximum number of register reads and writes and the worst
+ *              host time of each service are reported, in the format of the
+ *              budget file. When a budget file is given, a service exceeding
+ *              its budgeted reads or writes fails the run.
+ *
+ *              Usage: port_wcet [budget file]
+ *
+ * Author: Hussam Wael
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "Port.h"
+#include "Port_Sim.h"
+#include "Det.h"
+#include "Port_Bench.h"
+
+/* Timed calls per argument, the fastest one is kept to filter out the host noise */
+#define PORT_WCET_REPEAT               (20U)
+
+#define PORT_WCET_MAX_NAME             (32U)
+
+/* Every port mask of one port */
+#define PORT_WCET_MASKS                (256U)
+
+typedef struct
+{
+	const char * Name;
+
+	/* Number of argument combinations of the service */
+	uint32 Cases;
+
+	/* Puts the driver in the state the case runs from, not timed */
+	void (*Prepare)(uint32 Case);
+
+	void (*Run)(uint32 Case);
+
+}Port_WcetServiceType;
+
+typedef struct
+{
+	uint32 Reads;
+
+	uint32 Writes;
+
+	float64 WorstNs;
+
+	/* Argument combination giving the worst time */
+	uint32 WorstCase;
+
+}Port_WcetResultType;
+
+#if (PORT_CONTEXT_API == STD_ON)
+STATIC Port_ContextType Port_WcetContext;
+#endif
+
+STATIC void Port_WcetPrepareReset(uint32 Case)
+{
+	(void)Case;
+
+	Port_SimReset();
+}
+
+/* Initialize the driver completely, also with the deferred init */
+STATIC void Port_WcetInit(void)
+{
+	Port_Init(&Port_Configuration);
+
+#if (PORT_DEFERRED_INIT == STD_ON)
+	Port_CompleteInit();
+#endif
+}
+
+/* Case 0 runs Port_Init out of reset, case 1 initializes an initialized driver again */
+STATIC void Port_WcetPrepareInit(uint32 Case)
+{
+	Port_SimReset();
+
+	if(1U == Case){
+
+		Port_WcetInit();
+	}
+
+	else{
+		/* No Action Required */
+	}
+}
+
+STATIC void Port_WcetRunInit(uint32 Case)
+{
+	(void)Case;
+
+	Port_Init(&Port_Configuration);
+}
+
+#if (PORT_DEFERRED_INIT == STD_ON)
+/* Case n runs from Port_Init followed by n Port_MainFunction calls */
+STATIC void Port_WcetPreparePending(uint32 Case)
+{
+	Port_SimReset();
+	Port_Init(&Port_Configuration);
+
+	for(uint32 i = 0 ; i < Case ; i++){
+
+		Port_MainFunction();
+	}
+}
+
+STATIC void Port_WcetRunCompleteInit(uint32 Case)
+{
+	(void)Case;
+
+	Port_CompleteInit();
+}
+
+STATIC void Port_WcetRunMainFunction(uint32 Case)
+{
+	(void)Case;
+
+	Port_MainFunction();
+}
+#endif
+
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+STATIC void Port_WcetRunSetPinDirection(uint32 Case)
+{
+	Port_SetPinDirection((Port_PinType)(Case / 2U), (0U == (Case % 2U)) ? PORT_PIN_IN : PORT_PIN_OUT);
+}
+#endif
+
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+STATIC void Port_WcetRunSetGroupDirection(uint32 Case)
+{
+	Port_SetGroupDirection((Port_GroupType)(Case / 2U), (0U == (Case % 2U)) ? PORT_PIN_IN : PORT_PIN_OUT);
+}
+#endif
+
+STATIC void Port_WcetRunRefreshPortDirection(uint32 Case)
+{
+	(void)Case;
+
+	Port_RefreshPortDirection();
+}
+
+#if (PORT_VERSION_INFO_API == STD_ON)
+STATIC void Port_WcetRunGetVersionInfo(uint32 Case)
+{
+	Std_VersionInfoType VersionInfo;
+
+	(void)Case;
+
+	Port_GetVersionInfo(&VersionInfo);
+}
+#endif
+
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+/* Every mode plus one invalid mode */
+STATIC void Port_WcetRunSetPinMode(uint32 Case)
+{
+	Port_SetPinMode((Port_PinType)(Case / ((uint32)PORT_MODE_ADC + 2U)), (Port_PinModeType)(Case % ((uint32)PORT_MODE_ADC + 2U)));
+}
+#endif
+
+#if (PORT_MODE_PROFILE_API == STD_ON)
+/*
+ * Case n switches to profile n % (PROFILES + 1), one of them invalid, from profile
+ * n / (PROFILES + 1) applied after Port_Init, or from Port_Init itself for the last one
+ */
+STATIC void Port_WcetPrepareModeProfile(uint32 Case)
+{
+	Port_SimReset();
+	Port_WcetInit();
+
+	if((Case / (PORT_NUMBER_OF_MODE_PROFILES + 1U)) < PORT_NUMBER_OF_MODE_PROFILES){
+
+		Port_SetModeProfile((Port_ProfileType)(Case / (PORT_NUMBER_OF_MODE_PROFILES + 1U)));
+	}
+
+	else{
+		/* No Action Required */
+	}
+}
+
+STATIC void Port_WcetRunSetModeProfile(uint32 Case)
+{
+	Port_SetModeProfile((Port_ProfileType)(Case % (PORT_NUMBER_OF_MODE_PROFILES + 1U)));
+}
+#endif
+
+#if (PORT_PIN_INTERRUPT_API == STD_ON)
+STATIC void Port_WcetRunEnablePinInterrupts(uint32 Case)
+{
+	Port_EnablePinInterrupts((Port_PortType)(Case / PORT_WCET_MASKS), (Port_PinMaskType)(Case % PORT_WCET_MASKS));
+}
+
+STATIC void Port_WcetRunDisablePinInterrupts(uint32 Case)
+{
+	Port_DisablePinInterrupts((Port_PortType)(Case / PORT_WCET_MASKS), (Port_PinMaskType)(Case % PORT_WCET_MASKS));
+}
+#endif
+
+#if (PORT_SET_PIN_TRIGGER_API == STD_ON)
+/* Every trigger plus one invalid trigger */
+STATIC void Port_WcetRunSetPinTrigger(uint32 Case)
+{
+	Port_SetPinTrigger((Port_PinType)(Case / ((uint32)PORT_PIN_TRIGGER_ADC_AND_DMA + 2U)),
+			(Port_PinTriggerType)(Case % ((uint32)PORT_PIN_TRIGGER_ADC_AND_DMA + 2U)));
+}
+#endif
+
+#if (PORT_PIN_HANDLE_API == STD_ON)
+STATIC void Port_WcetRunGetPinHandle(uint32 Case)
+{
+	(void)Port_GetPinHandle((Port_PinType)Case);
+}
+
+STATIC void Port_WcetRunGetGroupHandle(uint32 Case)
+{
+	(void)Port_GetGroupHandle((Port_PortType)(Case / PORT_WCET_MASKS), (Port_PinMaskType)(Case % PORT_WCET_MASKS));
+}
+#endif
+
+#if (PORT_CONTEXT_API == STD_ON)
+STATIC void Port_WcetRunSaveContext(uint32 Case)
+{
+	(void)Case;
+
+	Port_SaveContext(&Port_WcetContext);
+}
+
+STATIC void Port_WcetRunRestoreContext(uint32 Case)
+{
+	(void)Case;
+
+	Port_RestoreContext(&Port_WcetContext);
+}
+#endif
+
+/* Arguments run past the last pin and port, so the error paths are bounded too */
+STATIC const Port_WcetServiceType Port_WcetServices[] = {
+		{"Port_Init", 2U, Port_WcetPrepareInit, Port_WcetRunInit},
+#if (PORT_DEFERRED_INIT == STD_ON)
+		{"Port_CompleteInit", PORT_NUMBER_OF_PORTS + 1U, Port_WcetPreparePending, Port_WcetRunCompleteInit},
+		{"Port_MainFunction", PORT_NUMBER_OF_PORTS + 1U, Port_WcetPreparePending, Port_WcetRunMainFunction},
+#endif
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+		{"Port_SetPinDirection", (PORT_NUMBER_OF_PORT_PINS + 1U) * 2U, NULL_PTR, Port_WcetRunSetPinDirection},
+#endif
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+		{"Port_SetGroupDirection", (PORT_NUMBER_OF_PIN_GROUPS + 1U) * 2U, NULL_PTR, Port_WcetRunSetGroupDirection},
+#endif
+		{"Port_RefreshPortDirection", 1U, NULL_PTR, Port_WcetRunRefreshPortDirection},
+#if (PORT_VERSION_INFO_API == STD_ON)
+		{"Port_GetVersionInfo", 1U, NULL_PTR, Port_WcetRunGetVersionInfo},
+#endif
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+		{"Port_SetPinMode", (PORT_NUMBER_OF_PORT_PINS + 1U) * ((uint32)PORT_MODE_ADC + 2U), NULL_PTR, Port_WcetRunSetPinMode},
+#endif
+#if (PORT_MODE_PROFILE_API == STD_ON)
+		{"Port_SetModeProfile", (PORT_NUMBER_OF_MODE_PROFILES + 1U) * (PORT_NUMBER_OF_MODE_PROFILES + 1U),
+				Port_WcetPrepareModeProfile, Port_WcetRunSetModeProfile},
+#endif
+#if (PORT_PIN_INTERRUPT_API == STD_ON)
+		{"Port_EnablePinInterrupts", (PORT_NUMBER_OF_PORTS + 1U) * PORT_WCET_MASKS, NULL_PTR, Port_WcetRunEnablePinInterrupts},
+		{"Port_DisablePinInterrupts", (PORT_NUMBER_OF_PORTS + 1U) * PORT_WCET_MASKS, NULL_PTR, Port_WcetRunDisablePinInterrupts},
+#endif
+#if (PORT_SET_PIN_TRIGGER_API == STD_ON)
+		{"Port_SetPinTrigger", (PORT_NUMBER_OF_PORT_PINS + 1U) * ((uint32)PORT_PIN_TRIGGER_ADC_AND_DMA + 2U), NULL_PTR, Port_WcetRunSetPinTrigger},
+#endif
+#if (PORT_PIN_HANDLE_API == STD_ON)
+		{"Port_GetPinHandle", PORT_NUMBER_OF_PORT_PINS + 1U, NULL_PTR, Port_WcetRunGetPinHandle},
+		{"Port_GetGroupHandle", (PORT_NUMBER_OF_PORTS + 1U) * PORT_WCET_MASKS, NULL_PTR, Port_WcetRunGetGroupHandle},
+#endif
+#if (PORT_CONTEXT_API == STD_ON)
+		{"Port_SaveContext", 1U, NULL_PTR, Port_WcetRunSaveContext},
+		{"Port_RestoreContext", 1U, Port_WcetPrepareReset, Port_WcetRunRestoreContext},
+#endif
+};
+
+#define PORT_WCET_NUMBER_OF_SERVICES   (sizeof(Port_WcetServices) / sizeof(Port_WcetServices[0]))
+
+STATIC Port_WcetResultType Port_WcetMeasure(const Port_WcetServiceType * Service)
+{
+	Port_WcetResultType Result = {0};
+
+	/* The runtime services run on the driver initialized with the linked configuration */
+	Port_SimReset();
+	Port_WcetInit();
+
+#if (PORT_CONTEXT_API == STD_ON)
+	Port_SaveContext(&Port_WcetContext);
+#endif
+
+	for(uint32 Case = 0 ; Case < Service->Cases ; Case++){
+
+		float64 Fastest = 0;
+
+		for(uint32 i = 0 ; i < PORT_WCET_REPEAT ; i++){
+
+			uint64 Start;
+			float64 Duration;
+
+			if(NULL_PTR != Service->Prepare){
+
+				Service->Prepare(Case);
+			}
+
+			else{
+				/* No Action Required */
+			}
+
+			Det_ClearErrors();
+			Port_SimClearCounters();
+
+			Start = Port_BenchNow();
+			Service->Run(Case);
+			Duration = (float64)(Port_BenchNow() - Start);
+
+			if((0U == i) || (Duration < Fastest)){
+
+				Fastest = Duration;
+			}
+
+			else{
+				/* No Action Required */
+			}
+		}
+
+		if(Port_SimGetReadCount() > Result.Reads){
+
+			Result.Reads = Port_SimGetReadCount();
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		if(Port_SimGetWriteCount() > Result.Writes){
+
+			Result.Writes = Port_SimGetWriteCount();
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		if(Fastest > Result.WorstNs){
+
+			Result.WorstNs = Fastest;
+			Result.WorstCase = Case;
+		}
+
+		else{
+			/* No Action Required */
+		}
+	}
+
+	return Result;
+}
+
+/* Budgeted reads and writes of a service, FALSE when the budget file does not list it */
+STATIC boolean Port_WcetFindBudget(const char * File, const char * Name, uint32 * Reads, uint32 * Writes)
+{
+	boolean Found = FALSE;
+	FILE * Budget = fopen(File, "r");
+	char Line[256];
+
+	while((NULL_PTR != Budget) && (FALSE == Found) && (NULL_PTR != fgets(Line, sizeof(Line), Budget))){
+
+		char Service[PORT_WCET_MAX_NAME];
+		unsigned BudgetReads;
+		unsigned BudgetWrites;
+
+		if(('#' != Line[0])
+				&& (3 == sscanf(Line, "%31s %u %u", Service, &BudgetReads, &BudgetWrites))
+				&& (0 == strcmp(Service, Name))){
+
+			*Reads = BudgetReads;
+			*Writes = BudgetWrites;
+			Found = TRUE;
+		}
+
+		else{
+			/* No Action Required */
+		}
+	}
+
+	if(NULL_PTR != Budget){
+
+		fclose(Budget);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	return Found;
+}
+
+int main(int argc, char * argv[])
+{
+	const char * BudgetFile = (argc > 1) ? argv[1] : NULL_PTR;
+	uint32 Regressions = 0;
+
+	if(NULL_PTR != BudgetFile){
+
+		FILE * Budget = fopen(BudgetFile, "r");
+
+		if(NULL_PTR == Budget){
+
+			printf("cannot open budget file %s\n", BudgetFile);
+
+			return 1;
+		}
+
+		else{
+
+			fclose(Budget);
+		}
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	printf("# Port driver worst case bounds: %u pins on %u ports\n",
+			(unsigned)PORT_NUMBER_OF_PORT_PINS, (unsigned)PORT_NUMBER_OF_PORTS);
+	printf("# %-26s %8s %8s %8s %12s %10s\n", "Service", "Reads", "Writes", "Cases", "Worst [ns]", "Worst case");
+
+	for(uint32 i = 0 ; i < PORT_WCET_NUMBER_OF_SERVICES ; i++){
+
+		const Port_WcetServiceType * Service = &Port_WcetServices[i];
+		Port_WcetResultType Result = Port_WcetMeasure(Service);
+		uint32 BudgetReads;
+		uint32 BudgetWrites;
+
+		printf("  %-26s %8u %8u %8u %12.1f %10u\n", Service->Name, Result.Reads, Result.Writes,
+				Service->Cases, Result.WorstNs, Result.WorstCase);
+
+		if(NULL_PTR == BudgetFile){
+			/* No Action Required */
+		}
+
+		else if(FALSE == Port_WcetFindBudget(BudgetFile, Service->Name, &BudgetReads, &BudgetWrites)){
+
+			printf("# %s has no budget in %s\n", Service->Name, BudgetFile);
+		}
+
+		else if((Result.Reads > BudgetReads) || (Result.Writes > BudgetWrites)){
+
+			printf("# REGRESSION %s: %u reads / %u writes, budget %u / %u\n",
+					Service->Name, Result.Reads, Result.Writes, BudgetReads, BudgetWrites);
+
+			Regressions++;
+		}
+
+		else{
+			/* No Action Required */
+		}
+	}
+
+	if(0U != Regressions){
+
+		printf("# %u services over budget\n", Regressions);
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	return (0U == Regressions) ? 0 : 1;
+}
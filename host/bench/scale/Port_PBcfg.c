@@ -0,0 +1,95 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_PBcfg.c
+ *
+ * Description: Post Build Configuration of the 140 pin scaling benchmark,
+ *              used with PORT_DEVICE_HOST_SCALE
+ *
+ * Author: Hussam Wael
+ ******************************************************************************/
+
+#include "Port.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define PORT_PBCFG_SW_MAJOR_VERSION              (1U)
+#define PORT_PBCFG_SW_MINOR_VERSION              (0U)
+#define PORT_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define PORT_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define PORT_PBCFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define PORT_PBCFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* AUTOSAR Version checking between Port_PBcfg.c and Port.h files */
+#if ((PORT_PBCFG_AR_RELEASE_MAJOR_VERSION != PORT_AR_RELEASE_MAJOR_VERSION)\
+		||  (PORT_PBCFG_AR_RELEASE_MINOR_VERSION != PORT_AR_RELEASE_MINOR_VERSION)\
+		||  (PORT_PBCFG_AR_RELEASE_PATCH_VERSION != PORT_AR_RELEASE_PATCH_VERSION))
+#error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Port_PBcfg.c and Port.h files */
+#if ((PORT_PBCFG_SW_MAJOR_VERSION != PORT_SW_MAJOR_VERSION)\
+		||  (PORT_PBCFG_SW_MINOR_VERSION != PORT_SW_MINOR_VERSION)\
+		||  (PORT_PBCFG_SW_PATCH_VERSION != PORT_SW_PATCH_VERSION))
+#error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+#if (PORT_NUMBER_OF_PORT_PINS != 140u)
+#error "The scaling benchmark configuration describes 140 pins"
+#endif
+
+/* Pins 0-3 of a port: analog input, pulled up input on falling edge, 8mA output driven high with slew control, alternate function */
+#define PORT_SCALE_LOW_PINS(PORT) \
+		{PORT, PORT_PIN0_ID, PORT_MODE_ADC,  PORT_PIN_LEVEL_LOW  , PORT_PIN_IN  , PORT_RESISTANCE_OFF,       PORT_PIN_MODE_CHANGEABLE     , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL}, \
+		{PORT, PORT_PIN1_ID, PORT_MODE_DIO,  PORT_PIN_LEVEL_LOW  , PORT_PIN_IN  , PORT_RESISTANCE_PULL_UP,   PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_INTERRUPT_FALLING_EDGE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL}, \
+		{PORT, PORT_PIN2_ID, PORT_MODE_DIO,  PORT_PIN_LEVEL_HIGH , PORT_PIN_OUT , PORT_RESISTANCE_OFF,       PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_8MA, PORT_PIN_SLEW_RATE_CONTROLLED, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL}, \
+		{PORT, PORT_PIN3_ID, PORT_MODE_ALT2, PORT_PIN_LEVEL_LOW  , PORT_PIN_IN  , PORT_RESISTANCE_OFF,       PORT_PIN_MODE_CHANGEABLE     , PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL}
+
+/* Pins 4-7 of a port: pulled down input triggering the ADC on rising edge, 4mA open drain output driven low, alternate function, plain input */
+#define PORT_SCALE_HIGH_PINS(PORT) \
+		{PORT, PORT_PIN4_ID, PORT_MODE_DIO,  PORT_PIN_LEVEL_LOW  , PORT_PIN_IN  , PORT_RESISTANCE_PULL_DOWN, PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_RISING_EDGE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_ADC, PORT_PIN_PRIORITY_NORMAL}, \
+		{PORT, PORT_PIN5_ID, PORT_MODE_DIO,  PORT_PIN_LEVEL_LOW  , PORT_PIN_OUT , PORT_RESISTANCE_OFF,       PORT_PIN_MODE_CHANGEABLE     , PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_4MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_OPEN_DRAIN, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL},     \
+		{PORT, PORT_PIN6_ID, PORT_MODE_ALT7, PORT_PIN_LEVEL_LOW  , PORT_PIN_IN  , PORT_RESISTANCE_OFF,       PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL}, \
+		{PORT, PORT_PIN7_ID, PORT_MODE_DIO,  PORT_PIN_LEVEL_LOW  , PORT_PIN_IN  , PORT_RESISTANCE_OFF,       PORT_PIN_MODE_NON_CHANGEABLE , PORT_PIN_DIRECTION_NON_CHANGEABLE, PORT_PIN_INTERRUPT_NONE, PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_RATE_FAST, PORT_PIN_OUTPUT_PUSH_PULL, PORT_PIN_TRIGGER_NONE, PORT_PIN_PRIORITY_NORMAL}
+
+#define PORT_SCALE_PORT(PORT)   PORT_SCALE_LOW_PINS(PORT), PORT_SCALE_HIGH_PINS(PORT)
+
+/* PB structure used with Port_Init API: 17 full ports and the low half of port 17 */
+const Port_ConfigType Port_Configuration = {
+
+		/* Pins */
+		{
+		PORT_SCALE_PORT(0),  PORT_SCALE_PORT(1),  PORT_SCALE_PORT(2),  PORT_SCALE_PORT(3),
+		PORT_SCALE_PORT(4),  PORT_SCALE_PORT(5),  PORT_SCALE_PORT(6),  PORT_SCALE_PORT(7),
+		PORT_SCALE_PORT(8),  PORT_SCALE_PORT(9),  PORT_SCALE_PORT(10), PORT_SCALE_PORT(11),
+		PORT_SCALE_PORT(12), PORT_SCALE_PORT(13), PORT_SCALE_PORT(14), PORT_SCALE_PORT(15),
+		PORT_SCALE_PORT(16), PORT_SCALE_LOW_PINS(17),
+		},
+
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+		/* Pin group: the direction changeable pins 1, 3 and 5 of port 0 */
+		{ {0, 0x2AU} },
+#endif
+
+#if (PORT_MODE_PROFILE_API == STD_ON)
+		/* Mode profiles: pin 0 of every port as analog input, then as digital pin */
+		{
+		{PORT_MODE_ADC, {0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U,
+		                 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U}},
+		{PORT_MODE_DIO, {0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U,
+		                 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U}},
+		},
+#endif
+
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+		/* Partition 0 owns the pins of port 0, no partition owns the other pins */
+		{ {{0xFFU}} },
+#endif
+
+};
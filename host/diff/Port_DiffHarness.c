@@ -0,0 +1,679 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_DiffHarness.c
+ *
+ * Description: Differential test harness of the Port Driver. Random valid
+ *              configurations and random sequences of runtime calls are run
+ *              through the reference driver and through Port.c on the
+ *              simulated register file, and the final register images are
+ *              compared. The register access counts of both are reported.
+ *              With the context API every case also runs on a driver restored
+ *              by Port_RestoreContext after the registers were reset and the
+ *              RAM of the driver was taken over by another configuration.
+ *
+ *              Usage: port_diff [cases] [seed]
+ *
+ * Author: Hussam Wael
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "Port.h"
+#include "Port_Regs.h"
+#include "Port_Sim.h"
+#include "Det.h"
+#include "Port_Reference.h"
+
+#define PORT_DIFF_DEFAULT_CASES       (2000U)
+#define PORT_DIFF_DEFAULT_SEED        (0x5EED1234U)
+
+/* Longest sequence of runtime calls after Port_Init */
+#define PORT_DIFF_MAX_OPERATIONS      (32U)
+
+/* Mismatches printed before the harness stays quiet */
+#define PORT_DIFF_MAX_PRINTED         (20U)
+
+#define PORT_DIFF_NUMBER_OF_REGS      (20U)
+
+/* Registers compared after every case */
+typedef struct
+{
+	const char * Name;
+
+	uint32 Offset;
+
+}Port_DiffRegisterType;
+
+STATIC const Port_DiffRegisterType Port_DiffRegisters[PORT_DIFF_NUMBER_OF_REGS] = {
+		{"DATA", GPIO_DATA_REG_OFFSET},
+		{"DIR", GPIO_DIR_REG_OFFSET},
+		{"IS", GPIO_IS_REG_OFFSET},
+		{"IBE", GPIO_IBE_REG_OFFSET},
+		{"IEV", GPIO_IEV_REG_OFFSET},
+		{"IM", GPIO_IM_REG_OFFSET},
+		{"AFSEL", GPIO_AFSEL_REG_OFFSET},
+		{"DR2R", GPIO_DR2R_REG_OFFSET},
+		{"DR4R", GPIO_DR4R_REG_OFFSET},
+		{"DR8R", GPIO_DR8R_REG_OFFSET},
+		{"ODR", GPIO_ODR_REG_OFFSET},
+		{"PUR", GPIO_PUR_REG_OFFSET},
+		{"PDR", GPIO_PDR_REG_OFFSET},
+		{"SLR", GPIO_SLR_REG_OFFSET},
+		{"DEN", GPIO_DEN_REG_OFFSET},
+		{"CR", GPIO_CR_REG_OFFSET},
+		{"AMSEL", GPIO_AMSEL_REG_OFFSET},
+		{"PCTL", GPIO_PCTL_REG_OFFSET},
+		{"ADCCTL", GPIO_ADCCTL_REG_OFFSET},
+		{"DMACTL", GPIO_DMACTL_REG_OFFSET}
+};
+
+typedef enum{
+
+	PORT_DIFF_SET_PIN_DIRECTION,
+	PORT_DIFF_SET_PIN_MODE,
+	PORT_DIFF_SET_GROUP_DIRECTION,
+	PORT_DIFF_SET_MODE_PROFILE,
+	PORT_DIFF_REFRESH_PORT_DIRECTION
+
+}Port_DiffOperationKind;
+
+typedef struct
+{
+	Port_DiffOperationKind Kind;
+
+	/* Pin, group of PORT_DIFF_SET_GROUP_DIRECTION or profile of PORT_DIFF_SET_MODE_PROFILE */
+	Port_PinType Pin;
+
+	/* Port_PinDirectionType or Port_PinModeType */
+	uint8 Value;
+
+}Port_DiffOperationType;
+
+/* Register image of the device after one run */
+typedef struct
+{
+	uint32 ClockGating;
+
+	uint32 Ports[PORT_NUMBER_OF_PORTS][PORT_DIFF_NUMBER_OF_REGS];
+
+	uint32 Reads;
+
+	uint32 Writes;
+
+}Port_DiffImageType;
+
+STATIC const Port_DeviceDescriptorType Port_DiffDevice[PORT_DEVICE_NUMBER_OF_PORTS] = PORT_DEVICE_DESCRIPTORS;
+
+STATIC uint32 Port_DiffRandomState;
+
+STATIC Port_ConfigType Port_DiffConfig;
+
+#if (PORT_CONTEXT_API == STD_ON)
+/* Configuration the driver holds when its context is restored */
+STATIC Port_ConfigType Port_DiffOtherConfig;
+STATIC Port_ContextType Port_DiffContext;
+#endif
+STATIC Port_DiffOperationType Port_DiffOperations[PORT_DIFF_MAX_OPERATIONS];
+STATIC uint32 Port_DiffNumberOfOperations;
+
+/* xorshift32, enough to spread the configurations */
+STATIC uint32 Port_DiffRandom(uint32 Range)
+{
+	Port_DiffRandomState ^= Port_DiffRandomState << 13;
+	Port_DiffRandomState ^= Port_DiffRandomState >> 17;
+	Port_DiffRandomState ^= Port_DiffRandomState << 5;
+
+	return Port_DiffRandomState % Range;
+}
+
+/* Random mode valid on the pin: PORT_MODE_ADC only on the analog pins */
+STATIC Port_PinModeType Port_DiffRandomMode(uint8 Port, uint8 Pin)
+{
+	Port_PinModeType Mode = (Port_PinModeType)Port_DiffRandom((uint32)PORT_MODE_ADC + 1U);
+
+	if((Mode == PORT_MODE_ADC) && (0U == (Port_DiffDevice[Port].AnalogPins & (((uint32)1) << Pin)))){
+
+		Mode = PORT_MODE_DIO;
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	return Mode;
+}
+
+/* Random configuration over distinct pins of the device, new pin features left at their defaults */
+STATIC void Port_DiffBuildConfig(void)
+{
+	uint8 Ports[PORT_NUMBER_OF_PORTS * 8U];
+	uint8 Pins[PORT_NUMBER_OF_PORTS * 8U];
+	uint32 Available = 0;
+
+	for(uint8 Port = PORT_PORTA_ID ; Port < PORT_NUMBER_OF_PORTS ; Port++){
+
+		for(uint8 Pin = PORT_PIN0_ID ; Pin < Port_DiffDevice[Port].NumberOfPins ; Pin++){
+
+			Ports[Available] = Port;
+			Pins[Available] = Pin;
+			Available++;
+		}
+	}
+
+	for(uint32 i = 0 ; i < PORT_NUMBER_OF_PORT_PINS ; i++){
+
+		uint32 Pick = i + Port_DiffRandom(Available - i);
+		uint8 Port = Ports[Pick];
+		uint8 Pin = Pins[Pick];
+		Port_ConfigPin * Config = &Port_DiffConfig.Pins[i];
+
+		Ports[Pick] = Ports[i];
+		Pins[Pick] = Pins[i];
+
+		Config->Port_Num = Port;
+		Config->Pin_Num = Pin;
+		Config->pin_mode = Port_DiffRandomMode(Port, Pin);
+		Config->initial_value = Port_DiffRandom(2U) ? PORT_PIN_LEVEL_HIGH : PORT_PIN_LEVEL_LOW;
+		Config->direction = Port_DiffRandom(2U) ? PORT_PIN_OUT : PORT_PIN_IN;
+		Config->resistance = (Port_PinInternalResistor)Port_DiffRandom((uint32)PORT_RESISTANCE_OFF + 1U);
+		Config->changeableMode = Port_DiffRandom(2U) ? PORT_PIN_MODE_CHANGEABLE : PORT_PIN_MODE_NON_CHANGEABLE;
+		Config->changeableDirection = Port_DiffRandom(2U) ? PORT_PIN_DIRECTION_CHANGEABLE : PORT_PIN_DIRECTION_NON_CHANGEABLE;
+		Config->interrupt = PORT_PIN_INTERRUPT_NONE;
+		Config->drive = PORT_PIN_DRIVE_2MA;
+		Config->slewRate = PORT_PIN_SLEW_RATE_FAST;
+		Config->outputType = PORT_PIN_OUTPUT_PUSH_PULL;
+		Config->trigger = PORT_PIN_TRIGGER_NONE;
+		Config->priority = Port_DiffRandom(2U) ? PORT_PIN_PRIORITY_CRITICAL : PORT_PIN_PRIORITY_NORMAL;
+	}
+
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+	/* Every group holds a random pin, made direction changeable, and some of the other direction changeable pins of its port */
+	for(uint32 Group = 0 ; Group < PORT_NUMBER_OF_PIN_GROUPS ; Group++){
+
+		Port_ConfigPin * Member = &Port_DiffConfig.Pins[Port_DiffRandom(PORT_NUMBER_OF_PORT_PINS)];
+		Port_ConfigGroup * Config = &Port_DiffConfig.Groups[Group];
+
+		Member->changeableDirection = PORT_PIN_DIRECTION_CHANGEABLE;
+
+		Config->Port = Member->Port_Num;
+		Config->Pins = (Port_PinMaskType)(((uint32)1) << Member->Pin_Num);
+
+		for(uint32 i = 0 ; i < PORT_NUMBER_OF_PORT_PINS ; i++){
+
+			const Port_ConfigPin * Pin = &Port_DiffConfig.Pins[i];
+
+			if((Pin->Port_Num == Config->Port) && (PORT_PIN_DIRECTION_CHANGEABLE == Pin->changeableDirection) && (0U != Port_DiffRandom(2U))){
+
+				Config->Pins |= (Port_PinMaskType)(((uint32)1) << Pin->Pin_Num);
+			}
+
+			else{
+				/* No Action Required */
+			}
+		}
+	}
+#endif
+
+#if (PORT_MODE_PROFILE_API == STD_ON)
+	/* Every profile holds a random pin, made mode changeable, and some of the other mode changeable pins taking its mode */
+	for(uint32 Profile = 0 ; Profile < PORT_NUMBER_OF_MODE_PROFILES ; Profile++){
+
+		Port_ConfigPin * Member = &Port_DiffConfig.Pins[Port_DiffRandom(PORT_NUMBER_OF_PORT_PINS)];
+		Port_ConfigProfile * Config = &Port_DiffConfig.Profiles[Profile];
+
+		Member->changeableMode = PORT_PIN_MODE_CHANGEABLE;
+
+		Config->Mode = Port_DiffRandomMode(Member->Port_Num, Member->Pin_Num);
+
+		for(uint8 Port = PORT_PORTA_ID ; Port < PORT_NUMBER_OF_PORTS ; Port++){
+
+			Config->Pins[Port] = 0U;
+		}
+
+		for(uint32 i = 0 ; i < PORT_NUMBER_OF_PORT_PINS ; i++){
+
+			const Port_ConfigPin * Pin = &Port_DiffConfig.Pins[i];
+			uint32 PinBit = ((uint32)1) << Pin->Pin_Num;
+
+			if((Pin == Member) || ((PORT_PIN_MODE_CHANGEABLE == Pin->changeableMode) && (0U != Port_DiffRandom(2U))
+					&& ((PORT_MODE_ADC != Config->Mode) || (0U != (Port_DiffDevice[Pin->Port_Num].AnalogPins & PinBit))))){
+
+				Config->Pins[Pin->Port_Num] |= (Port_PinMaskType)PinBit;
+			}
+
+			else{
+				/* No Action Required */
+			}
+		}
+	}
+#endif
+}
+
+/* Random sequence of valid runtime calls, so the driver never reports to Det */
+STATIC void Port_DiffBuildOperations(void)
+{
+	uint32 Count = Port_DiffRandom(PORT_DIFF_MAX_OPERATIONS + 1U);
+
+	Port_DiffNumberOfOperations = 0;
+
+	for(uint32 i = 0 ; i < Count ; i++){
+
+		Port_DiffOperationType * Operation = &Port_DiffOperations[Port_DiffNumberOfOperations];
+		Port_PinType Pin = (Port_PinType)Port_DiffRandom(PORT_NUMBER_OF_PORT_PINS);
+		const Port_ConfigPin * Config = &Port_DiffConfig.Pins[Pin];
+
+		Operation->Kind = (Port_DiffOperationKind)Port_DiffRandom((uint32)PORT_DIFF_REFRESH_PORT_DIRECTION + 1U);
+		Operation->Pin = Pin;
+
+		switch(Operation->Kind){
+
+		case PORT_DIFF_SET_PIN_DIRECTION:
+
+			Operation->Value = Port_DiffRandom(2U) ? PORT_PIN_OUT : PORT_PIN_IN;
+
+			if((PORT_SET_PIN_DIRECTION_API == STD_ON) && (PORT_PIN_DIRECTION_CHANGEABLE == Config->changeableDirection)){
+
+				Port_DiffNumberOfOperations++;
+			}
+
+			else{
+				/* No Action Required */
+			}
+			break;
+
+		case PORT_DIFF_SET_PIN_MODE:
+
+			Operation->Value = (uint8)Port_DiffRandomMode(Config->Port_Num, Config->Pin_Num);
+
+			if((PORT_SET_PIN_MODE_API == STD_ON) && (PORT_PIN_MODE_CHANGEABLE == Config->changeableMode)){
+
+				Port_DiffNumberOfOperations++;
+			}
+
+			else{
+				/* No Action Required */
+			}
+			break;
+
+		case PORT_DIFF_SET_GROUP_DIRECTION:
+
+			Operation->Pin = (Port_PinType)Port_DiffRandom(PORT_NUMBER_OF_PIN_GROUPS);
+			Operation->Value = Port_DiffRandom(2U) ? PORT_PIN_OUT : PORT_PIN_IN;
+
+			if(PORT_SET_GROUP_DIRECTION_API == STD_ON){
+
+				Port_DiffNumberOfOperations++;
+			}
+
+			else{
+				/* No Action Required */
+			}
+			break;
+
+		case PORT_DIFF_SET_MODE_PROFILE:
+
+			Operation->Pin = (Port_PinType)Port_DiffRandom(PORT_NUMBER_OF_MODE_PROFILES);
+
+			if(PORT_MODE_PROFILE_API == STD_ON){
+
+				Port_DiffNumberOfOperations++;
+			}
+
+			else{
+				/* No Action Required */
+			}
+			break;
+
+		default:
+
+			Port_DiffNumberOfOperations++;
+			break;
+		}
+	}
+}
+
+STATIC void Port_DiffTakeImage(Port_DiffImageType * Image)
+{
+	Image->Reads = Port_SimGetReadCount();
+	Image->Writes = Port_SimGetWriteCount();
+	Image->ClockGating = Port_SimPeek(PORT_CLOCK_GATING_REG_ADDRESS);
+
+	for(uint8 Port = PORT_PORTA_ID ; Port < PORT_NUMBER_OF_PORTS ; Port++){
+
+		for(uint32 Reg = 0 ; Reg < PORT_DIFF_NUMBER_OF_REGS ; Reg++){
+
+			Image->Ports[Port][Reg] = Port_SimPeek(GPIO_REG(Port_DiffDevice[Port].BaseAddress, Port_DiffRegisters[Reg].Offset));
+		}
+	}
+}
+
+STATIC void Port_DiffRunReference(Port_DiffImageType * Image)
+{
+	Port_SimReset();
+
+	Port_ReferenceInit(&Port_DiffConfig);
+
+	for(uint32 i = 0 ; i < Port_DiffNumberOfOperations ; i++){
+
+		const Port_DiffOperationType * Operation = &Port_DiffOperations[i];
+
+		switch(Operation->Kind){
+
+		case PORT_DIFF_SET_PIN_DIRECTION:
+
+			Port_ReferenceSetPinDirection(Operation->Pin, (Port_PinDirectionType)Operation->Value);
+			break;
+
+		case PORT_DIFF_SET_PIN_MODE:
+
+			Port_ReferenceSetPinMode(Operation->Pin, (Port_PinModeType)Operation->Value);
+			break;
+
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+		/* The reference sets the direction of the pins of the group one by one */
+		case PORT_DIFF_SET_GROUP_DIRECTION:
+
+			for(Port_PinType Pin = 0 ; Pin < PORT_NUMBER_OF_PORT_PINS ; Pin++){
+
+				const Port_ConfigGroup * Group = &Port_DiffConfig.Groups[Operation->Pin];
+
+				if((Port_DiffConfig.Pins[Pin].Port_Num == Group->Port)
+						&& (0U != (Group->Pins & (((uint32)1) << Port_DiffConfig.Pins[Pin].Pin_Num)))){
+
+					Port_ReferenceSetPinDirection(Pin, (Port_PinDirectionType)Operation->Value);
+				}
+
+				else{
+					/* No Action Required */
+				}
+			}
+			break;
+#endif
+
+#if (PORT_MODE_PROFILE_API == STD_ON)
+		/* The reference sets the mode of the pins of the profile one by one */
+		case PORT_DIFF_SET_MODE_PROFILE:
+
+			for(Port_PinType Pin = 0 ; Pin < PORT_NUMBER_OF_PORT_PINS ; Pin++){
+
+				const Port_ConfigProfile * Profile = &Port_DiffConfig.Profiles[Operation->Pin];
+
+				if(0U != (Profile->Pins[Port_DiffConfig.Pins[Pin].Port_Num] & (((uint32)1) << Port_DiffConfig.Pins[Pin].Pin_Num))){
+
+					Port_ReferenceSetPinMode(Pin, Profile->Mode);
+				}
+
+				else{
+					/* No Action Required */
+				}
+			}
+			break;
+#endif
+
+		default:
+
+			Port_ReferenceRefreshPortDirection();
+			break;
+		}
+	}
+
+	Port_DiffTakeImage(Image);
+}
+
+STATIC void Port_DiffRunDriver(Port_DiffImageType * Image, boolean Restore)
+{
+	Port_SimReset();
+	Det_ClearErrors();
+
+	Port_Init(&Port_DiffConfig);
+
+#if (PORT_CONTEXT_API == STD_ON)
+	/* Hibernation: only the context survives, the driver comes back with Port_RestoreContext */
+	if(TRUE == Restore){
+
+		Port_SaveContext(&Port_DiffContext);
+
+		Port_Init(&Port_DiffOtherConfig);
+		Port_SimReset();
+
+		Port_RestoreContext(&Port_DiffContext);
+	}
+
+	else{
+		/* No Action Required */
+	}
+#else
+	(void)Restore;
+#endif
+
+	for(uint32 i = 0 ; i < Port_DiffNumberOfOperations ; i++){
+
+		const Port_DiffOperationType * Operation = &Port_DiffOperations[i];
+
+		switch(Operation->Kind){
+
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+		case PORT_DIFF_SET_PIN_DIRECTION:
+
+			Port_SetPinDirection(Operation->Pin, (Port_PinDirectionType)Operation->Value);
+			break;
+#endif
+
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+		case PORT_DIFF_SET_PIN_MODE:
+
+			Port_SetPinMode(Operation->Pin, (Port_PinModeType)Operation->Value);
+			break;
+#endif
+
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+		case PORT_DIFF_SET_GROUP_DIRECTION:
+
+			Port_SetGroupDirection((Port_GroupType)Operation->Pin, (Port_PinDirectionType)Operation->Value);
+			break;
+#endif
+
+#if (PORT_MODE_PROFILE_API == STD_ON)
+		case PORT_DIFF_SET_MODE_PROFILE:
+
+			Port_SetModeProfile((Port_ProfileType)Operation->Pin);
+			break;
+#endif
+
+		default:
+
+			Port_RefreshPortDirection();
+			break;
+		}
+	}
+
+	Port_DiffTakeImage(Image);
+}
+
+/* Print the differences of one run of a case, returns the number of differing registers */
+STATIC uint32 Port_DiffCompare(uint32 Case, const char * Run, const Port_DiffImageType * Reference, const Port_DiffImageType * Driver, uint32 Printed)
+{
+	uint32 Differences = 0;
+
+	if(Reference->ClockGating != Driver->ClockGating){
+
+		if(Printed < PORT_DIFF_MAX_PRINTED){
+
+			printf("case %u%s: clock gating 0x%08X, expected 0x%08X\n", Case, Run, Driver->ClockGating, Reference->ClockGating);
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		Differences++;
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	for(uint8 Port = PORT_PORTA_ID ; Port < PORT_NUMBER_OF_PORTS ; Port++){
+
+		for(uint32 Reg = 0 ; Reg < PORT_DIFF_NUMBER_OF_REGS ; Reg++){
+
+			if(Reference->Ports[Port][Reg] != Driver->Ports[Port][Reg]){
+
+				if((Printed + Differences) < PORT_DIFF_MAX_PRINTED){
+
+					printf("case %u%s: port %u %s 0x%08X, expected 0x%08X\n", Case, Run, Port,
+							Port_DiffRegisters[Reg].Name, Driver->Ports[Port][Reg], Reference->Ports[Port][Reg]);
+				}
+
+				else{
+					/* No Action Required */
+				}
+
+				Differences++;
+			}
+
+			else{
+				/* No Action Required */
+			}
+		}
+	}
+
+	return Differences;
+}
+
+int main(int argc, char * argv[])
+{
+	uint32 Cases = (argc > 1) ? (uint32)strtoul(argv[1], NULL, 0) : PORT_DIFF_DEFAULT_CASES;
+	uint32 Seed = (argc > 2) ? (uint32)strtoul(argv[2], NULL, 0) : PORT_DIFF_DEFAULT_SEED;
+	uint32 DevicePins = 0;
+	uint32 FailedCases = 0;
+	uint32 Differences = 0;
+	uint32 DetCases = 0;
+	uint64 ReferenceAccesses = 0;
+	uint64 DriverAccesses = 0;
+	sint32 MinSaved = 0;
+	sint32 MaxSaved = 0;
+	static Port_DiffImageType Reference;
+	static Port_DiffImageType Driver;
+#if (PORT_CONTEXT_API == STD_ON)
+	static Port_DiffImageType Restored;
+#endif
+
+	Port_DiffRandomState = (0U != Seed) ? Seed : PORT_DIFF_DEFAULT_SEED;
+
+	for(uint8 Port = PORT_PORTA_ID ; Port < PORT_NUMBER_OF_PORTS ; Port++){
+
+		DevicePins += Port_DiffDevice[Port].NumberOfPins;
+	}
+
+	if(DevicePins < PORT_NUMBER_OF_PORT_PINS){
+
+		printf("the device has %u pins, the configuration needs %u\n", DevicePins, (unsigned)PORT_NUMBER_OF_PORT_PINS);
+
+		return 1;
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	printf("Port driver differential test: %u pins on %u ports, %u cases, seed 0x%08X\n",
+			(unsigned)PORT_NUMBER_OF_PORT_PINS, (unsigned)PORT_NUMBER_OF_PORTS, Cases, Seed);
+
+#if (PORT_CONTEXT_API == STD_ON)
+	Port_DiffBuildConfig();
+	Port_DiffOtherConfig = Port_DiffConfig;
+#endif
+
+	for(uint32 Case = 0 ; Case < Cases ; Case++){
+
+		uint32 CaseDifferences;
+		uint32 CaseReports;
+		sint32 Saved;
+
+		Port_DiffBuildConfig();
+		Port_DiffBuildOperations();
+
+		Port_DiffRunReference(&Reference);
+		Port_DiffRunDriver(&Driver, FALSE);
+
+		CaseDifferences = Port_DiffCompare(Case, "", &Reference, &Driver, Differences);
+		CaseReports = Det_GetNumberOfReports();
+
+#if (PORT_CONTEXT_API == STD_ON)
+		Port_DiffRunDriver(&Restored, TRUE);
+
+		CaseDifferences += Port_DiffCompare(Case, " (restored)", &Reference, &Restored, Differences + CaseDifferences);
+		CaseReports += Det_GetNumberOfReports();
+#endif
+
+		if(0U != CaseReports){
+
+			if(Differences < PORT_DIFF_MAX_PRINTED){
+
+				printf("case %u: %u unexpected Det reports\n", Case, CaseReports);
+			}
+
+			else{
+				/* No Action Required */
+			}
+
+			DetCases++;
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		if((0U != CaseDifferences) || (0U != CaseReports)){
+
+			FailedCases++;
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		Differences += CaseDifferences;
+
+		/* Accesses saved by the driver over the reference in this case */
+		Saved = (sint32)(Reference.Reads + Reference.Writes) - (sint32)(Driver.Reads + Driver.Writes);
+
+		if((0U == Case) || (Saved < MinSaved)){
+
+			MinSaved = Saved;
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		if((0U == Case) || (Saved > MaxSaved)){
+
+			MaxSaved = Saved;
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		ReferenceAccesses += Reference.Reads + Reference.Writes;
+		DriverAccesses += Driver.Reads + Driver.Writes;
+	}
+
+	printf("register accesses per case: reference %.1f, driver %.1f, saved min %d / mean %.1f / max %d (%.1f%%)\n",
+			(Cases != 0U) ? (float64)ReferenceAccesses / Cases : 0.0,
+			(Cases != 0U) ? (float64)DriverAccesses / Cases : 0.0,
+			MinSaved,
+			(Cases != 0U) ? ((float64)ReferenceAccesses - (float64)DriverAccesses) / Cases : 0.0,
+			MaxSaved,
+			(ReferenceAccesses != 0U) ? 100.0 * ((float64)ReferenceAccesses - (float64)DriverAccesses) / (float64)ReferenceAccesses : 0.0);
+
+	printf("%u of %u cases failed: %u register differences, %u cases with Det reports\n",
+			FailedCases, Cases, Differences, DetCases);
+
+	return (0U == FailedCases) ? 0 : 1;
+}
@@ -0,0 +1,172 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Reference.c
+ *
+ * Description: Reference Port Driver used by the differential test harness.
+ *              Every pin is programmed on its own with a read-modify-write per
+ *              register, as the driver did before the per port register images.
+ *              Only the register addresses come from the device descriptors so
+ *              the reference runs on every simulated device.
+ *
+ * Author: Hussam Wael
+ ******************************************************************************/
+
+#include "Port_Reference.h"
+#include "Port_Regs.h"
+
+STATIC const Port_DeviceDescriptorType Port_RefDevice[PORT_DEVICE_NUMBER_OF_PORTS] = PORT_DEVICE_DESCRIPTORS;
+
+STATIC const Port_ConfigPin * Port_RefPins = (Port_Configuration.Pins);
+
+/* Set bits of a register with a read-modify-write */
+STATIC void Port_RefSetBits(uint32 Address, uint32 Bits)
+{
+	PORT_REG_WRITE(Address, PORT_REG_READ(Address) | Bits);
+}
+
+/* Set or clear one bit of a register with a read-modify-write */
+STATIC void Port_RefWriteBit(uint32 Address, uint8 Bit, uint32 Value)
+{
+	PORT_REG_MODIFY(Address, ((uint32)1) << Bit, ((uint32)(Value & 1U)) << Bit);
+}
+
+void Port_ReferenceInit(const Port_ConfigType * ConfigPtr)
+{
+	boolean ClockConfigured[PORT_NUMBER_OF_PORTS] = {FALSE};
+
+	Port_RefPins = ConfigPtr->Pins;
+
+	for(Port_PinType i = PORT_PIN0_ID ; i < PORT_NUMBER_OF_PORT_PINS ; i++){
+
+		uint8 Pin = Port_RefPins[i].Pin_Num;
+		uint32 Base = Port_RefDevice[Port_RefPins[i].Port_Num].BaseAddress;
+
+		/*Step 1 : Configure the CLock*/
+		if(ClockConfigured[Port_RefPins[i].Port_Num] == FALSE){
+
+			Port_RefWriteBit(PORT_CLOCK_GATING_REG_ADDRESS, Port_RefPins[i].Port_Num, 1U);
+
+			ClockConfigured[Port_RefPins[i].Port_Num] = TRUE;
+		}
+
+		/*Step 2 : Unlock a pin if required*/
+		if(0U != (Port_RefDevice[Port_RefPins[i].Port_Num].LockedPins & (((uint32)1) << Pin))){
+
+			PORT_REG_WRITE(GPIO_REG(Base, GPIO_LOCK_REG_OFFSET), UNLOCKING_VALUE);
+
+			Port_RefWriteBit(GPIO_REG(Base, GPIO_CR_REG_OFFSET), Pin, 1U);
+		}
+
+		/*Step 3 : Set digital or analog*/
+		if(Port_RefPins[i].pin_mode == PORT_MODE_ADC){
+
+			Port_RefWriteBit(GPIO_REG(Base, GPIO_AMSEL_REG_OFFSET), Pin, 1U);
+			Port_RefWriteBit(GPIO_REG(Base, GPIO_DEN_REG_OFFSET), Pin, 0U);
+		}
+
+		else{
+			Port_RefWriteBit(GPIO_REG(Base, GPIO_AMSEL_REG_OFFSET), Pin, 0U);
+			Port_RefWriteBit(GPIO_REG(Base, GPIO_DEN_REG_OFFSET), Pin, 1U);
+		}
+
+		/*Step 4 : Set the Alternate function*/
+		PORT_REG_MODIFY(GPIO_REG(Base, GPIO_PCTL_REG_OFFSET), ((uint32)0x0F) << (4 * Pin), 0U);
+
+		switch(Port_RefPins[i].pin_mode){
+
+		case PORT_MODE_DIO:
+		case PORT_MODE_ADC:
+
+			Port_RefWriteBit(GPIO_REG(Base, GPIO_AFSEL_REG_OFFSET), Pin, 0U);
+			break;
+
+		default:
+
+			Port_RefWriteBit(GPIO_REG(Base, GPIO_AFSEL_REG_OFFSET), Pin, 1U);
+			Port_RefSetBits(GPIO_REG(Base, GPIO_PCTL_REG_OFFSET), ((uint32)Port_RefPins[i].pin_mode) << (4 * Pin));
+		}
+
+		/*Step 5 : Set the Direction of the pin*/
+		Port_RefWriteBit(GPIO_REG(Base, GPIO_DIR_REG_OFFSET), Pin, Port_RefPins[i].direction);
+
+		/*Step 6 : Set the initial value*/
+		if(Port_RefPins[i].direction == PORT_PIN_OUT){
+
+			Port_RefWriteBit(GPIO_REG(Base, GPIO_DATA_REG_OFFSET), Pin, Port_RefPins[i].initial_value);
+		}
+
+		/*Step 7 : Configure Internal Resistances*/
+		else if(Port_RefPins[i].resistance == PORT_RESISTANCE_PULL_UP){
+
+			Port_RefWriteBit(GPIO_REG(Base, GPIO_PUR_REG_OFFSET), Pin, 1U);
+		}
+
+		else if(Port_RefPins[i].resistance == PORT_RESISTANCE_PULL_DOWN){
+
+			Port_RefWriteBit(GPIO_REG(Base, GPIO_PDR_REG_OFFSET), Pin, 1U);
+		}
+
+		else{
+			/* No Action Required */
+		}
+	}
+}
+
+void Port_ReferenceSetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
+{
+	Port_RefWriteBit(GPIO_REG(Port_RefDevice[Port_RefPins[Pin].Port_Num].BaseAddress, GPIO_DIR_REG_OFFSET),
+			Port_RefPins[Pin].Pin_Num,
+			Direction);
+}
+
+void Port_ReferenceRefreshPortDirection(void)
+{
+	for(Port_PinType i = PORT_PIN0_ID ; i < PORT_NUMBER_OF_PORT_PINS ; i++){
+
+		if(PORT_PIN_DIRECTION_NON_CHANGEABLE == Port_RefPins[i].changeableDirection){
+
+			Port_RefWriteBit(GPIO_REG(Port_RefDevice[Port_RefPins[i].Port_Num].BaseAddress, GPIO_DIR_REG_OFFSET),
+					Port_RefPins[i].Pin_Num,
+					Port_RefPins[i].direction);
+		}
+
+		else{
+			/* No Action Required */
+		}
+	}
+}
+
+void Port_ReferenceSetPinMode(Port_PinType Pin, Port_PinModeType Mode)
+{
+	uint8 PinNum = Port_RefPins[Pin].Pin_Num;
+	uint32 Base = Port_RefDevice[Port_RefPins[Pin].Port_Num].BaseAddress;
+
+	if(Mode == PORT_MODE_ADC){
+
+		Port_RefWriteBit(GPIO_REG(Base, GPIO_AMSEL_REG_OFFSET), PinNum, 1U);
+		Port_RefWriteBit(GPIO_REG(Base, GPIO_DEN_REG_OFFSET), PinNum, 0U);
+	}
+
+	else{
+		Port_RefWriteBit(GPIO_REG(Base, GPIO_AMSEL_REG_OFFSET), PinNum, 0U);
+		Port_RefWriteBit(GPIO_REG(Base, GPIO_DEN_REG_OFFSET), PinNum, 1U);
+	}
+
+	PORT_REG_MODIFY(GPIO_REG(Base, GPIO_PCTL_REG_OFFSET), ((uint32)0x0F) << (4 * PinNum), 0U);
+
+	switch(Mode){
+
+	case PORT_MODE_DIO:
+	case PORT_MODE_ADC:
+
+		Port_RefWriteBit(GPIO_REG(Base, GPIO_AFSEL_REG_OFFSET), PinNum, 0U);
+		break;
+
+	default:
+
+		Port_RefWriteBit(GPIO_REG(Base, GPIO_AFSEL_REG_OFFSET), PinNum, 1U);
+		Port_RefSetBits(GPIO_REG(Base, GPIO_PCTL_REG_OFFSET), ((uint32)Mode) << (4 * PinNum));
+	}
+}
@@ -0,0 +1,27 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Reference.h
+ *
+ * Description: Reference Port Driver used by the differential test harness.
+ *              It keeps the original pin by pin algorithm of Port.c, without
+ *              the DET checks, so the optimised driver can be compared to it.
+ *
+ * Author: Hussam Wael
+ ******************************************************************************/
+
+#ifndef PORT_REFERENCE_H_
+#define PORT_REFERENCE_H_
+
+#include "Port.h"
+
+void Port_ReferenceInit(const Port_ConfigType * ConfigPtr);
+
+void Port_ReferenceSetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction);
+
+void Port_ReferenceRefreshPortDirection(void);
+
+void Port_ReferenceSetPinMode(Port_PinType Pin, Port_PinModeType Mode);
+
+#endif /* PORT_REFERENCE_H_ */
@@ -0,0 +1,274 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_ErrorCheck.c
+ *
+ * Description: Host check of the error path of the Port Driver built with the
+ *              error monitor. Calls wrong in several ways must reach Det once,
+ *              with the first error of their checks, and the monitor must
+ *              count, rate limit and clear the errors of every service.
+ *              Returns 1 if any check fails.
+ *
+ *              Usage: port_errcheck
+ *
+ * Author: Hussam Wael
+ ******************************************************************************/
+
+#include <stdio.h>
+
+#include "Port.h"
+#include "Port_Sim.h"
+#include "Det.h"
+
+#if (PORT_ERROR_MONITOR != STD_ON)
+#error "port_errcheck needs a driver built with PORT_ERROR_MONITOR"
+#endif
+
+#if (PORT_CONFIG_VARIANT == PORT_VARIANT_PRE_COMPILE)
+#define PORT_CHECK_INIT_CONFIG        (NULL_PTR)
+#else
+#define PORT_CHECK_INIT_CONFIG        (&Port_Configuration)
+#endif
+
+/* Calls over the rate limit made by the rate limit check */
+#define PORT_CHECK_EXTRA_CALLS        (6U)
+
+/* Det reports expected for Errors rejected calls of one service */
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+#define PORT_CHECK_REPORTS(Errors)    (((0U == PORT_DET_RATE_LIMIT) || ((Errors) < PORT_DET_RATE_LIMIT)) ? (Errors) : PORT_DET_RATE_LIMIT)
+#else
+#define PORT_CHECK_REPORTS(Errors)    (0U)
+#endif
+
+/* Pin and mode both out of range */
+#define PORT_CHECK_BAD_PIN            ((Port_PinType)PORT_NUMBER_OF_PORT_PINS)
+#define PORT_CHECK_BAD_MODE           ((Port_PinModeType)(PORT_MODE_ADC + 1U))
+
+STATIC uint32 Port_CheckCount = 0U;
+STATIC uint32 Port_CheckFailures = 0U;
+
+STATIC void Port_Check(const char * Name, boolean Passed)
+{
+	Port_CheckCount++;
+
+	if(FALSE == Passed){
+
+		Port_CheckFailures++;
+
+		printf("FAILED: %s\n", Name);
+	}
+
+	else{
+		/* No Action Required */
+	}
+}
+
+/* TRUE when the only Det report since Det_ClearErrors is ErrorId of ServiceId, or none without Det */
+STATIC boolean Port_CheckSingleReport(uint8 ServiceId, uint8 ErrorId)
+{
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	Det_ErrorType Report;
+
+	return (boolean)((1U == Det_GetNumberOfReports()) && (E_OK == Det_GetReport(0U, &Report))
+			&& (PORT_MODULE_ID == Report.ModuleId) && (ServiceId == Report.ApiId) && (ErrorId == Report.ErrorId));
+#else
+	(void)ServiceId;
+	(void)ErrorId;
+
+	return (boolean)(0U == Det_GetNumberOfReports());
+#endif
+}
+
+/* TRUE when the status of ServiceId holds exactly the given values */
+STATIC boolean Port_CheckStatus(uint8 ServiceId, uint32 Errors, uint16 Detected, uint16 Suppressed)
+{
+	Port_ErrorStatusType Status;
+
+	return (boolean)((E_OK == Port_GetErrorStatus(ServiceId, &Status))
+			&& (Errors == Status.Errors) && (Detected == Status.Detected) && (Suppressed == Status.Suppressed));
+}
+
+/* Calls rejected on several counts before Port_Init, each reported once as PORT_E_UNINIT */
+STATIC void Port_CheckUninit(void)
+{
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+	Det_ClearErrors();
+	Port_SetPinMode(PORT_CHECK_BAD_PIN, PORT_CHECK_BAD_MODE);
+	Port_Check("Port_SetPinMode before Port_Init: one PORT_E_UNINIT report",
+			Port_CheckSingleReport(PORT_SET_PIN_MODE_SID, PORT_E_UNINIT));
+#endif
+
+#if (PORT_SET_PIN_TRIGGER_API == STD_ON)
+	Det_ClearErrors();
+	Port_SetPinTrigger(PORT_CHECK_BAD_PIN, (Port_PinTriggerType)(PORT_PIN_TRIGGER_ADC_AND_DMA + 1));
+	Port_Check("Port_SetPinTrigger before Port_Init: one PORT_E_UNINIT report",
+			Port_CheckSingleReport(PORT_SET_PIN_TRIGGER_SID, PORT_E_UNINIT));
+#endif
+
+#if (PORT_PIN_INTERRUPT_API == STD_ON)
+	Det_ClearErrors();
+	Port_EnablePinInterrupts((Port_PortType)PORT_NUMBER_OF_PORTS, 0xFFU);
+	Port_Check("Port_EnablePinInterrupts before Port_Init: one PORT_E_UNINIT report",
+			Port_CheckSingleReport(PORT_ENABLE_PIN_INTERRUPTS_SID, PORT_E_UNINIT));
+
+	Det_ClearErrors();
+	Port_DisablePinInterrupts((Port_PortType)PORT_NUMBER_OF_PORTS, 0xFFU);
+	Port_Check("Port_DisablePinInterrupts before Port_Init: one PORT_E_UNINIT report",
+			Port_CheckSingleReport(PORT_DISABLE_PIN_INTERRUPTS_SID, PORT_E_UNINIT));
+#endif
+
+#if (PORT_PIN_HANDLE_API == STD_ON)
+	Det_ClearErrors();
+	(void)Port_GetGroupHandle((Port_PortType)PORT_NUMBER_OF_PORTS, 0U);
+	Port_Check("Port_GetGroupHandle before Port_Init: one PORT_E_UNINIT report",
+			Port_CheckSingleReport(PORT_GET_GROUP_HANDLE_SID, PORT_E_UNINIT));
+#endif
+
+#if (PORT_CONTEXT_API == STD_ON)
+	Det_ClearErrors();
+	Port_SaveContext(NULL_PTR);
+	Port_Check("Port_SaveContext before Port_Init: one PORT_E_UNINIT report",
+			Port_CheckSingleReport(PORT_SAVE_CONTEXT_SID, PORT_E_UNINIT));
+#endif
+}
+
+/* Calls rejected on several counts once initialized, each reported once with its first error */
+STATIC void Port_CheckInitialized(void)
+{
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+	Det_ClearErrors();
+	Port_SetPinMode(PORT_CHECK_BAD_PIN, PORT_CHECK_BAD_MODE);
+	Port_Check("Port_SetPinMode with a bad pin and mode: one PORT_E_PARAM_PIN report",
+			Port_CheckSingleReport(PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN));
+#endif
+
+#if (PORT_SET_PIN_TRIGGER_API == STD_ON)
+	Det_ClearErrors();
+	Port_SetPinTrigger(PORT_CHECK_BAD_PIN, (Port_PinTriggerType)(PORT_PIN_TRIGGER_ADC_AND_DMA + 1));
+	Port_Check("Port_SetPinTrigger with a bad pin and trigger: one PORT_E_PARAM_PIN report",
+			Port_CheckSingleReport(PORT_SET_PIN_TRIGGER_SID, PORT_E_PARAM_PIN));
+#endif
+
+#if (PORT_PIN_INTERRUPT_API == STD_ON)
+	Det_ClearErrors();
+	Port_EnablePinInterrupts(PORT_PORTF_ID, 0xFFU);
+	Port_Check("Port_EnablePinInterrupts with pins without an interrupt: one PORT_E_PARAM_PIN report",
+			Port_CheckSingleReport(PORT_ENABLE_PIN_INTERRUPTS_SID, PORT_E_PARAM_PIN));
+	Port_Check("Port_EnablePinInterrupts rejected: the exclusive area is left",
+			(boolean)(0U == Port_SimGetExclusiveAreaDepth()));
+
+	Det_ClearErrors();
+	Port_EnablePinInterrupts((Port_PortType)PORT_NUMBER_OF_PORTS, 0x10U);
+	Port_Check("Port_EnablePinInterrupts with a bad port: one PORT_E_PARAM_PORT report",
+			Port_CheckSingleReport(PORT_ENABLE_PIN_INTERRUPTS_SID, PORT_E_PARAM_PORT));
+
+	/* PF4, the button of the configuration, has a falling edge interrupt */
+	Port_EnablePinInterrupts(PORT_PORTF_ID, 0x10U);
+	Port_DisablePinInterrupts(PORT_PORTF_ID, 0x10U);
+	Port_Check("Port_EnablePinInterrupts and Port_DisablePinInterrupts leave the exclusive area",
+			(boolean)(0U == Port_SimGetExclusiveAreaDepth()));
+#endif
+
+#if (PORT_PIN_HANDLE_API == STD_ON)
+	Det_ClearErrors();
+	Port_Check("Port_GetGroupHandle with a bad port: an invalid handle",
+			(boolean)(PORT_INVALID_PIN_HANDLE == Port_GetGroupHandle((Port_PortType)PORT_NUMBER_OF_PORTS, 0x01U)));
+	Port_Check("Port_GetGroupHandle with a bad port: one PORT_E_PARAM_PORT report",
+			Port_CheckSingleReport(PORT_GET_GROUP_HANDLE_SID, PORT_E_PARAM_PORT));
+#endif
+}
+
+#if (PORT_CONTEXT_API == STD_ON)
+
+STATIC Port_ContextType Port_CheckContext;
+
+/* A saved context changed after Port_SaveContext is rejected once and leaves the driver uninitialized */
+STATIC void Port_CheckRestoreContext(void)
+{
+	Port_SaveContext(&Port_CheckContext);
+
+	Port_CheckContext.Ports[PORT_PORTF_ID].Dir ^= 0x01U;
+
+	Det_ClearErrors();
+	Port_RestoreContext(&Port_CheckContext);
+	Port_Check("Port_RestoreContext with a changed context: one PORT_E_PARAM_CONFIG report",
+			Port_CheckSingleReport(PORT_RESTORE_CONTEXT_SID, PORT_E_PARAM_CONFIG));
+	Port_Check("Port_RestoreContext with a changed context: the driver is left uninitialized",
+			(boolean)(PORT_NOT_INITIALIZED == Port_GetStatus()));
+
+	Port_CheckContext.Ports[PORT_PORTF_ID].Dir ^= 0x01U;
+
+	Det_ClearErrors();
+	Port_RestoreContext(&Port_CheckContext);
+	Port_Check("Port_RestoreContext with the saved context: no report and the driver initialized",
+			(boolean)((0U == Det_GetNumberOfReports()) && (PORT_INITIALIZED == Port_GetStatus())));
+}
+
+#endif
+
+/* Past PORT_DET_RATE_LIMIT errors of a service, Det hears no more of them until the counters are reset */
+STATIC void Port_CheckRateLimit(void)
+{
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+	uint16 Calls = (uint16)(PORT_DET_RATE_LIMIT + PORT_CHECK_EXTRA_CALLS);
+	uint16 Suppressed = (0U == PORT_DET_RATE_LIMIT) ? 0U : PORT_CHECK_EXTRA_CALLS;
+
+	Port_ResetErrorCounters();
+	Det_ClearErrors();
+
+	for(uint16 i = 0 ; i < Calls ; i++){
+
+		Port_SetPinMode(PORT_CHECK_BAD_PIN, PORT_CHECK_BAD_MODE);
+	}
+
+	Port_Check("rate limit: Det reports",
+			(boolean)(PORT_CHECK_REPORTS(Calls) == Det_GetNumberOfReports()));
+	Port_Check("rate limit: Detected and Suppressed",
+			Port_CheckStatus(PORT_SET_PIN_MODE_SID, PORT_ERROR_BIT(PORT_E_PARAM_PIN), Calls, Suppressed));
+	Port_Check("rate limit: other services untouched",
+			Port_CheckStatus(PORT_SET_PIN_DIRECTION_SID, 0U, 0U, 0U));
+
+	Port_ResetErrorCounters();
+
+	Port_Check("Port_ResetErrorCounters clears the status",
+			Port_CheckStatus(PORT_SET_PIN_MODE_SID, 0U, 0U, 0U));
+
+	Det_ClearErrors();
+	Port_SetPinMode(PORT_CHECK_BAD_PIN, PORT_CHECK_BAD_MODE);
+
+	Port_Check("Port_ResetErrorCounters: the next error reaches Det",
+			Port_CheckSingleReport(PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN));
+	Port_Check("Port_ResetErrorCounters: the next error is counted",
+			Port_CheckStatus(PORT_SET_PIN_MODE_SID, PORT_ERROR_BIT(PORT_E_PARAM_PIN), 1U, 0U));
+#endif
+
+	{
+		Port_ErrorStatusType Status;
+
+		Port_Check("Port_GetErrorStatus rejects an unknown service",
+				(boolean)(E_NOT_OK == Port_GetErrorStatus(PORT_NUMBER_OF_SERVICES, &Status)));
+	}
+}
+
+int main(void)
+{
+	Port_SimReset();
+
+	Port_CheckUninit();
+
+	Port_Init(PORT_CHECK_INIT_CONFIG);
+
+	Port_CheckInitialized();
+
+#if (PORT_CONTEXT_API == STD_ON)
+	Port_CheckRestoreContext();
+#endif
+
+	Port_CheckRateLimit();
+
+	printf("Port driver error path: %u of %u checks failed (Det %s, rate limit %u)\n", Port_CheckFailures, Port_CheckCount,
+			(PORT_DEV_ERROR_DETECT == STD_ON) ? "on" : "off", (unsigned)PORT_DET_RATE_LIMIT);
+
+	return (0U == Port_CheckFailures) ? 0 : 1;
+}
@@ -0,0 +1,399 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_ConfigImage.c
+ *
+ * Description: Host tool for the binary configuration images of the Port
+ *              Driver. 'build' writes the image of the Port_Configuration
+ *              linked with the tool (Port_PBcfg.c), ready to be flashed in
+ *              the slot of Port_ConfigImage. 'inspect' prints the header and
+ *              the pins of an image, checks its CRC and runs Port_Init on it
+ *              in place, on the simulated register file. 'reject' corrupts
+ *              one row of an image at a time, recomputes its CRC and checks
+ *              that Port_Init rejects it.
+ *
+ *              The host and the target lay out Port_ConfigType the same way
+ *              (little endian, 32-bit enums), the header records the payload
+ *              size so a mismatch is rejected by Port_Init.
+ *
+ *              Usage: port_cfgimage build <image>
+ *                     port_cfgimage inspect <image>
+ *                     port_cfgimage reject <image>
+ *
+ * Author: Hussam Wael
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "Port.h"
+#include "Port_Sim.h"
+#include "Det.h"
+
+#if (PORT_CONFIG_IMAGE_SUPPORT != STD_ON)
+#error "port_cfgimage needs a driver built with PORT_CONFIG_IMAGE_SUPPORT"
+#endif
+
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+#define PORT_TOOL_GROUPS              (PORT_NUMBER_OF_PIN_GROUPS)
+#else
+#define PORT_TOOL_GROUPS              (0U)
+#endif
+
+/* Image read by 'inspect', one byte more than an image so a longer file is noticed */
+STATIC union
+{
+	Port_ConfigImageType Image;
+
+	uint8 Bytes[sizeof(Port_ConfigImageType) + 1U];
+
+}Port_ToolBuffer;
+
+/* CRC-32 (IEEE 802.3) bit by bit, independent of the table driven one of Port.c */
+STATIC uint32 Port_ToolCrc32(const uint8 * Data, uint32 Length)
+{
+	uint32 Crc = 0xFFFFFFFFU;
+
+	for(uint32 i = 0 ; i < Length ; i++){
+
+		Crc ^= Data[i];
+
+		for(uint32 Bit = 0 ; Bit < 8U ; Bit++){
+
+			Crc = (0U != (Crc & 1U)) ? ((Crc >> 1) ^ 0xEDB88320U) : (Crc >> 1);
+		}
+	}
+
+	return ~Crc;
+}
+
+STATIC int Port_ToolBuild(const char * Path)
+{
+	static Port_ConfigImageType Image;
+	FILE * File = fopen(Path, "wb");
+	int Result = 1;
+
+	if(NULL_PTR == File){
+
+		printf("cannot create %s\n", Path);
+	}
+
+	else{
+
+		/* Port_Configuration has static storage, so its padding is zero like the rest of Image */
+		Image.Config = Port_Configuration;
+
+		Image.Header.Magic = PORT_CONFIG_IMAGE_MAGIC;
+		Image.Header.FormatVersion = PORT_CONFIG_IMAGE_FORMAT_VERSION;
+		Image.Header.PinCount = PORT_NUMBER_OF_PORT_PINS;
+		Image.Header.SwMajorVersion = PORT_SW_MAJOR_VERSION;
+		Image.Header.SwMinorVersion = PORT_SW_MINOR_VERSION;
+		Image.Header.SwPatchVersion = PORT_SW_PATCH_VERSION;
+		Image.Header.ArMajorVersion = PORT_AR_RELEASE_MAJOR_VERSION;
+		Image.Header.ArMinorVersion = PORT_AR_RELEASE_MINOR_VERSION;
+		Image.Header.ArPatchVersion = PORT_AR_RELEASE_PATCH_VERSION;
+		Image.Header.GroupCount = PORT_TOOL_GROUPS;
+		Image.Header.PayloadSize = sizeof(Port_ConfigType);
+		Image.Header.Crc = Port_ToolCrc32((const uint8 *)&Image.Config, sizeof(Port_ConfigType));
+
+		if(1U == fwrite(&Image, sizeof(Image), 1U, File)){
+
+			printf("%s: %u pins, %u bytes, CRC 0x%08X\n", Path, (unsigned)PORT_NUMBER_OF_PORT_PINS,
+					(unsigned)sizeof(Image), Image.Header.Crc);
+
+			Result = 0;
+		}
+
+		else{
+
+			printf("cannot write %s\n", Path);
+		}
+
+		(void)fclose(File);
+	}
+
+	return Result;
+}
+
+STATIC void Port_ToolPrintPins(const Port_ConfigType * Config, uint32 PinCount)
+{
+	printf("%4s %5s %4s %5s %4s %6s %4s %9s %4s\n", "Pin", "Port", "Bit", "Mode", "Dir", "Level", "Res", "Interrupt", "Prio");
+
+	for(uint32 i = 0 ; i < PinCount ; i++){
+
+		const Port_ConfigPin * Pin = &Config->Pins[i];
+
+		printf("%4u %5u %4u %5u %4s %6s %4u %9u %4s\n", i, Pin->Port_Num, Pin->Pin_Num, Pin->pin_mode,
+				(PORT_PIN_OUT == Pin->direction) ? "out" : "in",
+				(PORT_PIN_LEVEL_HIGH == Pin->initial_value) ? "high" : "low",
+				(unsigned)Pin->resistance, (unsigned)Pin->interrupt,
+				(PORT_PIN_PRIORITY_CRITICAL == Pin->priority) ? "crit" : "");
+	}
+}
+
+/* Read an image into Port_ToolBuffer, returns its size or 0 */
+STATIC size_t Port_ToolRead(const char * Path)
+{
+	FILE * File = fopen(Path, "rb");
+	size_t Size = 0U;
+
+	if(NULL_PTR == File){
+
+		printf("cannot open %s\n", Path);
+	}
+
+	else{
+
+		Size = fread(Port_ToolBuffer.Bytes, 1U, sizeof(Port_ToolBuffer.Bytes), File);
+		(void)fclose(File);
+	}
+
+	return Size;
+}
+
+STATIC int Port_ToolInspect(const char * Path)
+{
+	const Port_ConfigImageHeaderType * Header = &Port_ToolBuffer.Image.Header;
+	size_t Size = Port_ToolRead(Path);
+	uint32 Crc;
+	int Result = 1;
+
+	if(0U == Size){
+
+		return 1;
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	printf("%s: %u bytes\n", Path, (unsigned)Size);
+
+	if(Size < sizeof(Port_ConfigImageHeaderType)){
+
+		printf("too short for a header of %u bytes\n", (unsigned)sizeof(Port_ConfigImageHeaderType));
+
+		return 1;
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	printf("magic 0x%08X%s, format %u, SW %u.%u.%u, AR %u.%u.%u\n",
+			Header->Magic, (PORT_CONFIG_IMAGE_MAGIC == Header->Magic) ? "" : " (bad)", Header->FormatVersion,
+			Header->SwMajorVersion, Header->SwMinorVersion, Header->SwPatchVersion,
+			Header->ArMajorVersion, Header->ArMinorVersion, Header->ArPatchVersion);
+	printf("%u pins, %u groups, payload %u bytes\n", Header->PinCount, Header->GroupCount, Header->PayloadSize);
+
+	if(Size != (sizeof(Port_ConfigImageHeaderType) + Header->PayloadSize)){
+
+		printf("the file does not hold the header and its payload\n");
+	}
+
+	else if(sizeof(Port_ConfigImageType) != Size){
+
+		printf("the payload is not the Port_ConfigType of this driver (%u bytes)\n", (unsigned)sizeof(Port_ConfigType));
+	}
+
+	else{
+
+		Crc = Port_ToolCrc32((const uint8 *)&Port_ToolBuffer.Image.Config, Header->PayloadSize);
+
+		printf("CRC 0x%08X (%s)\n", Header->Crc, (Crc == Header->Crc) ? "ok" : "bad");
+
+		if(Header->PinCount <= PORT_NUMBER_OF_PORT_PINS){
+
+			Port_ToolPrintPins(&Port_ToolBuffer.Image.Config, Header->PinCount);
+		}
+
+		else{
+			/* No Action Required */
+		}
+
+		/* Port_Init reads the configuration where the image was loaded */
+		Port_SimReset();
+		Det_ClearErrors();
+
+		Port_Init(&Port_ToolBuffer.Image.Config);
+
+		if(PORT_INITIALIZED == Port_GetStatus()){
+
+			printf("Port_Init: accepted, %u reads / %u writes\n", Port_SimGetReadCount(), Port_SimGetWriteCount());
+
+			Result = 0;
+		}
+
+		else{
+
+			printf("Port_Init: rejected, %u Det reports\n", Det_GetNumberOfReports());
+		}
+	}
+
+	return Result;
+}
+
+/*
+ * Rows of a valid image put out of range one at a time: the CRC still matches,
+ * only the range check of Port_Init can reject them
+ */
+STATIC void Port_ToolBadPort(Port_ConfigType * Config)
+{
+	Config->Pins[0].Port_Num = PORT_NUMBER_OF_PORTS;
+}
+
+STATIC void Port_ToolBadPin(Port_ConfigType * Config)
+{
+	Config->Pins[PORT_NUMBER_OF_PORT_PINS - 1U].Pin_Num = 7U;
+}
+
+STATIC void Port_ToolBadMode(Port_ConfigType * Config)
+{
+	Config->Pins[0].pin_mode = PORT_MODE_ADC + 1U;
+}
+
+STATIC void Port_ToolBadDirection(Port_ConfigType * Config)
+{
+	Config->Pins[0].direction = (Port_PinDirectionType)(PORT_PIN_OUT + 1);
+}
+
+STATIC void Port_ToolBadInterrupt(Port_ConfigType * Config)
+{
+	Config->Pins[0].interrupt = (Port_PinInterruptType)(PORT_PIN_INTERRUPT_HIGH_LEVEL + 1);
+}
+
+STATIC void Port_ToolBadPriority(Port_ConfigType * Config)
+{
+	Config->Pins[0].priority = (Port_PinPriorityType)(PORT_PIN_PRIORITY_CRITICAL + 1);
+}
+
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+STATIC void Port_ToolBadGroup(Port_ConfigType * Config)
+{
+	Config->Groups[0].Port = PORT_NUMBER_OF_PORTS;
+}
+#endif
+
+#if (PORT_MODE_PROFILE_API == STD_ON)
+STATIC void Port_ToolBadProfile(Port_ConfigType * Config)
+{
+	Config->Profiles[0].Mode = PORT_MODE_ADC + 1U;
+}
+
+STATIC void Port_ToolBadProfilePins(Port_ConfigType * Config)
+{
+	Config->Profiles[0].Pins[PORT_NUMBER_OF_PORTS - 1U] = 0x80U;
+}
+#endif
+
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+STATIC void Port_ToolBadPartition(Port_ConfigType * Config)
+{
+	Config->Partitions[0].Pins[0] = 0x100U;
+}
+#endif
+
+typedef struct
+{
+	const char * Name;
+
+	void (*Corrupt)(Port_ConfigType * Config);
+
+}Port_ToolCorruptionType;
+
+STATIC const Port_ToolCorruptionType Port_ToolCorruptions[] = {
+		{"pin port", Port_ToolBadPort},
+		{"pin number", Port_ToolBadPin},
+		{"pin mode", Port_ToolBadMode},
+		{"pin direction", Port_ToolBadDirection},
+		{"pin interrupt", Port_ToolBadInterrupt},
+		{"pin priority", Port_ToolBadPriority},
+#if (PORT_SET_GROUP_DIRECTION_API == STD_ON)
+		{"group port", Port_ToolBadGroup},
+#endif
+#if (PORT_MODE_PROFILE_API == STD_ON)
+		{"profile mode", Port_ToolBadProfile},
+		{"profile pins", Port_ToolBadProfilePins},
+#endif
+#if (PORT_PIN_OWNERSHIP == STD_ON)
+		{"partition pins", Port_ToolBadPartition},
+#endif
+};
+
+#define PORT_TOOL_CORRUPTIONS         (sizeof(Port_ToolCorruptions) / sizeof(Port_ToolCorruptions[0]))
+
+STATIC int Port_ToolReject(const char * Path)
+{
+	static Port_ConfigImageType Valid;
+	uint32 Rejected = 0U;
+
+	if(sizeof(Port_ConfigImageType) != Port_ToolRead(Path)){
+
+		printf("%s is not an image of this driver\n", Path);
+
+		return 1;
+	}
+
+	else{
+		/* No Action Required */
+	}
+
+	Valid = Port_ToolBuffer.Image;
+
+	for(uint32 i = 0 ; i < PORT_TOOL_CORRUPTIONS ; i++){
+
+		Port_ToolBuffer.Image = Valid;
+		Port_ToolCorruptions[i].Corrupt(&Port_ToolBuffer.Image.Config);
+		Port_ToolBuffer.Image.Header.Crc = Port_ToolCrc32((const uint8 *)&Port_ToolBuffer.Image.Config, sizeof(Port_ConfigType));
+
+		Port_SimReset();
+		Det_ClearErrors();
+
+		Port_Init(&Port_ToolBuffer.Image.Config);
+
+		/* A rejected image leaves the driver uninitialized and every register at reset */
+		if((PORT_INITIALIZED != Port_GetStatus()) && (0U == Port_SimGetWriteCount())){
+
+			Rejected++;
+		}
+
+		else{
+
+			printf("bad %s: accepted\n", Port_ToolCorruptions[i].Name);
+		}
+	}
+
+	printf("%u of %u corrupt images rejected\n", (unsigned)Rejected, (unsigned)PORT_TOOL_CORRUPTIONS);
+
+	return (PORT_TOOL_CORRUPTIONS == Rejected) ? 0 : 1;
+}
+
+int main(int argc, char * argv[])
+{
+	int Result = 2;
+
+	if((3 == argc) && (0 == strcmp(argv[1], "build"))){
+
+		Result = Port_ToolBuild(argv[2]);
+	}
+
+	else if((3 == argc) && (0 == strcmp(argv[1], "inspect"))){
+
+		Result = Port_ToolInspect(argv[2]);
+	}
+
+	else if((3 == argc) && (0 == strcmp(argv[1], "reject"))){
+
+		Result = Port_ToolReject(argv[2]);
+	}
+
+	else{
+
+		printf("usage: port_cfgimage build <image>\n"
+				"       port_cfgimage inspect <image>\n"
+				"       port_cfgimage reject <image>\n");
+	}
+
+	return Result;
+}
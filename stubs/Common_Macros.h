@@ -0,0 +1,39 @@
+/******************************************************************************
+ *
+ * Module: Common - Macros
+ *
+ * File Name: Common_Macros.h
+ *
+ * Description: Commonly used Macros
+ *
+ * Author: Hussam Wael
+ ******************************************************************************/
+
+#ifndef COMMON_MACROS_H_
+#define COMMON_MACROS_H_
+
+/* Set a certain bit in any register */
+#define SET_BIT(REG,BIT) (REG|=(1U<<(BIT)))
+
+/* Clear a certain bit in any register */
+#define CLEAR_BIT(REG,BIT) (REG&=(~(1U<<(BIT))))
+
+/* Toggle a certain bit in any register */
+#define TOGGLE_BIT(REG,BIT) (REG^=(1U<<(BIT)))
+
+/* Write a value (0 or 1) to a certain bit in any register */
+#define WRITE_BIT(REG,BIT,VALUE) (REG = ((REG) & (~(1U<<(BIT)))) | (((uint32)(VALUE) & 1U)<<(BIT)))
+
+/* Rotate right the register value with specific number of rotates */
+#define ROR(REG,num) ( REG= (REG>>num) | (REG<<((sizeof(REG)*8)-num)) )
+
+/* Rotate left the register value with specific number of rotates */
+#define ROL(REG,num) ( REG= (REG<<num) | (REG>>((sizeof(REG)*8)-num)) )
+
+/* Check if a specific bit is set in any register and return true if yes */
+#define BIT_IS_SET(REG,BIT) ( REG & (1U<<(BIT)) )
+
+/* Check if a specific bit is cleared in any register and return true if yes */
+#define BIT_IS_CLEAR(REG,BIT) ( !(REG & (1U<<(BIT))) )
+
+#endif /* COMMON_MACROS_H_ */
@@ -0,0 +1,90 @@
+/******************************************************************************
+ *
+ * Module: Det
+ *
+ * File Name: Det.h
+ *
+ * Description: Det stores the development errors reported by other modules.
+ *              This header describes the APIs of the Det stub used by the
+ *              host build.
+ *
+ * Author: Hussam Wael
+ ******************************************************************************/
+
+#ifndef DET_H_
+#define DET_H_
+
+/* Id for the company in the AUTOSAR
+ * for example Hussam Wael's ID = 1000 :) */
+#define DET_VENDOR_ID             (1000U)
+
+/* Det Module Id */
+#define DET_MODULE_ID             (15U)
+
+/* Det Instance Id */
+#define DET_INSTANCE_ID           (0U)
+
+/*
+ * Det Software Module Version 1.0.0
+ */
+#define DET_SW_MAJOR_VERSION      (1U)
+#define DET_SW_MINOR_VERSION      (0U)
+#define DET_SW_PATCH_VERSION      (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define DET_AR_MAJOR_VERSION      (4U)
+#define DET_AR_MINOR_VERSION      (0U)
+#define DET_AR_PATCH_VERSION      (3U)
+
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Det Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != DET_AR_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != DET_AR_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != DET_AR_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Maximum number of errors kept by the recording Det stub */
+#define DET_MAX_RECORDED_ERRORS   (64U)
+
+/* One development error as received by Det_ReportError */
+typedef struct
+{
+  uint16 ModuleId;
+  uint8  InstanceId;
+  uint8  ApiId;
+  uint8  ErrorId;
+} Det_ErrorType;
+
+/************************************************************************************
+ * Service Name: Det_ReportError
+ * Service ID[hex]: 0x01
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): ModuleId - Module Id of calling module.
+ *                  InstanceId - The identifier of the index based instance of a module.
+ *                  ApiId - Id of API service in which error is detected.
+ *                  ErrorId - ID of detected development error.
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Std_ReturnType - always returns E_OK.
+ * Description: Service to report development errors.
+ ************************************************************************************/
+Std_ReturnType Det_ReportError( uint16 ModuleId,
+                                uint8 InstanceId,
+                                uint8 ApiId,
+                                uint8 ErrorId );
+
+/* Number of errors reported since the last Det_ClearErrors call */
+uint32 Det_GetNumberOfReports(void);
+
+/* Copy of the Index-th recorded error, returns E_NOT_OK if it was not recorded */
+Std_ReturnType Det_GetReport(uint32 Index, Det_ErrorType * Error);
+
+/* Forget all the recorded errors */
+void Det_ClearErrors(void);
+
+#endif /* DET_H_ */